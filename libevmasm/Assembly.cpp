@@ -57,12 +57,13 @@ AssemblyItem const& Assembly::append(AssemblyItem const& _i)
 
 unsigned Assembly::bytesRequired(unsigned subTagSize) const
 {
+	size_t dataSize = 1;
+	for (auto const& i: m_data)
+		dataSize += i.second.size();
+
 	for (unsigned tagSize = subTagSize; true; ++tagSize)
 	{
-		size_t ret = 1;
-		for (auto const& i: m_data)
-			ret += i.second.size();
-
+		size_t ret = dataSize;
 		for (AssemblyItem const& i: m_items)
 			ret += i.bytesRequired(tagSize);
 		if (util::bytesRequired(ret) <= tagSize)
@@ -543,7 +544,8 @@ map<u256, u256> Assembly::optimiseInternal(
 			_settings.isCreation,
 			_settings.isCreation ? 1 : _settings.expectedExecutionsPerDeployment,
 			_settings.evmVersion,
-			*this
+			*this,
+			_settings.constantOptimisationCache.get()
 		);
 
 	return tagReplacements;
@@ -599,7 +601,8 @@ LinkerObject const& Assembly::assemble() const
 
 	unsigned bytesRequiredForCode = bytesRequired(static_cast<unsigned>(subTagSize));
 	m_tagPositionsInBytecode = vector<size_t>(m_usedTags, numeric_limits<size_t>::max());
-	map<size_t, pair<size_t, size_t>> tagRef;
+	// Positions of tag references in the bytecode (in increasing order) and the referenced (sub id, tag id).
+	vector<pair<size_t, pair<size_t, size_t>>> tagRef;
 	multimap<h256, unsigned> dataRef;
 	multimap<size_t, size_t> subRef;
 	vector<unsigned> sizeRef; ///< Pointers to code locations where the size of the program is inserted
@@ -650,7 +653,7 @@ LinkerObject const& Assembly::assemble() const
 		case PushTag:
 		{
 			ret.bytecode.push_back(tagPush);
-			tagRef[ret.bytecode.size()] = i.splitForeignPushTag();
+			tagRef.emplace_back(ret.bytecode.size(), i.splitForeignPushTag());
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerTag);
 			break;
 		}
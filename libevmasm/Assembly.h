@@ -42,6 +42,8 @@
 namespace solidity::evmasm
 {
 
+class ConstantOptimisationCache;
+
 using AssemblyPointer = std::shared_ptr<Assembly>;
 
 class Assembly
@@ -127,6 +129,9 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = frontend::OptimiserSettings{}.expectedExecutionsPerDeployment;
+		/// If set, the constant optimiser reuses the representations chosen for
+		/// other assemblies of the same compilation.
+		std::shared_ptr<ConstantOptimisationCache> constantOptimisationCache;
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
@@ -25,6 +25,7 @@
 #include <libsolutil/FixedHash.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <charconv>
 #include <fstream>
 
 using namespace std;
@@ -102,7 +103,7 @@ size_t AssemblyItem::bytesRequired(size_t _addressLength) const
 size_t AssemblyItem::arguments() const
 {
 	if (type() == Operation)
-		return static_cast<size_t>(instructionInfo(instruction()).args);
+		return static_cast<size_t>(instructionMetadata(instruction()).args);
 	else if (type() == VerbatimBytecode)
 		return get<0>(*m_verbatimBytecode);
 	else if (type() == AssignImmutable)
@@ -116,7 +117,7 @@ size_t AssemblyItem::returnValues() const
 	switch (m_type)
 	{
 	case Operation:
-		return static_cast<size_t>(instructionInfo(instruction()).ret);
+		return static_cast<size_t>(instructionMetadata(instruction()).ret);
 	case Push:
 	case PushString:
 	case PushTag:
@@ -336,6 +337,19 @@ std::string AssemblyItem::computeSourceMapping(
 )
 {
 	string ret;
+	// Most items need only a few characters, so this avoids almost all reallocations.
+	ret.reserve(_items.size() * 4);
+
+	auto appendNumber = [&](int _value)
+	{
+		char buffer[16];
+		auto result = to_chars(buffer, buffer + sizeof(buffer), _value);
+		ret.append(buffer, result.ptr);
+	};
+
+	// Consecutive items usually share the same source, so remember the last lookup.
+	shared_ptr<string const> lastSourceName;
+	int lastSourceIndex = -1;
 
 	int prevStart = -1;
 	int prevLength = -1;
@@ -345,14 +359,17 @@ std::string AssemblyItem::computeSourceMapping(
 	for (auto const& item: _items)
 	{
 		if (!ret.empty())
-			ret += ";";
+			ret += ';';
 
 		SourceLocation const& location = item.location();
 		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			(location.sourceName && _sourceIndicesMap.count(*location.sourceName)) ?
-			static_cast<int>(_sourceIndicesMap.at(*location.sourceName)) :
-			-1;
+		if (location.sourceName != lastSourceName)
+		{
+			lastSourceName = location.sourceName;
+			auto const* index = lastSourceName ? util::valueOrNullptr(_sourceIndicesMap, *lastSourceName) : nullptr;
+			lastSourceIndex = index ? static_cast<int>(*index) : -1;
+		}
+		int sourceIndex = lastSourceIndex;
 		char jump = '-';
 		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction)
 			jump = 'i';
@@ -383,17 +400,17 @@ std::string AssemblyItem::computeSourceMapping(
 		if (components-- > 0)
 		{
 			if (location.start != prevStart)
-				ret += to_string(location.start);
+				appendNumber(location.start);
 			if (components-- > 0)
 			{
 				ret += ':';
 				if (length != prevLength)
-					ret += to_string(length);
+					appendNumber(length);
 				if (components-- > 0)
 				{
 					ret += ':';
 					if (sourceIndex != prevSourceIndex)
-						ret += to_string(sourceIndex);
+						appendNumber(sourceIndex);
 					if (components-- > 0)
 					{
 						ret += ':';
@@ -403,7 +420,7 @@ std::string AssemblyItem::computeSourceMapping(
 						{
 							ret += ':';
 							if (modifierDepth != prevModifierDepth)
-								ret += to_string(modifierDepth);
+								appendNumber(modifierDepth);
 						}
 					}
 				}
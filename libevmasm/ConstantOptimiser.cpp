@@ -24,17 +24,34 @@
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
 
+#include <libsolutil/CommonData.h>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
 
+optional<ConstantOptimisationCache::Representation> ConstantOptimisationCache::find(Key const& _key) const
+{
+	if (auto const* representation = util::valueOrNullptr(m_representations, _key))
+		return *representation;
+	return nullopt;
+}
+
+void ConstantOptimisationCache::store(Key _key, Representation _representation)
+{
+	m_representations.emplace(move(_key), move(_representation));
+}
+
 unsigned ConstantOptimisationMethod::optimiseConstants(
 	bool _isCreation,
 	size_t _runs,
 	langutil::EVMVersion _evmVersion,
-	Assembly& _assembly
+	Assembly& _assembly,
+	ConstantOptimisationCache* _cache
 )
 {
+	using Representation = ConstantOptimisationCache::Representation;
+
 	// TODO: design the optimiser in a way this is not needed
 	AssemblyItems& _items = _assembly.items();
 
@@ -54,22 +71,44 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 		params.isCreation = _isCreation;
 		params.runs = _runs;
 		params.evmVersion = _evmVersion;
-		LiteralMethod lit(params, item.data());
-		bigint literalGas = lit.gasNeeded();
-		CodeCopyMethod copy(params, item.data());
-		bigint copyGas = copy.gasNeeded();
-		ComputeMethod compute(params, item.data());
-		bigint computeGas = compute.gasNeeded();
-		AssemblyItems replacement;
-		if (copyGas < literalGas && copyGas < computeGas)
+
+		ConstantOptimisationCache::Key cacheKey{item.data(), params.multiplicity, _isCreation, _runs, _evmVersion};
+		optional<Representation> representation;
+		if (_cache)
+			representation = _cache->find(cacheKey);
+		if (!representation)
 		{
-			replacement = copy.execute(_assembly);
-			optimisations++;
+			representation.emplace();
+			LiteralMethod lit(params, item.data());
+			bigint literalGas = lit.gasNeeded();
+			CodeCopyMethod copy(params, item.data());
+			bigint copyGas = copy.gasNeeded();
+			ComputeMethod compute(params, item.data());
+			bigint computeGas = compute.gasNeeded();
+			if (copyGas < literalGas && copyGas < computeGas)
+				representation->method = Representation::Method::CodeCopy;
+			else if (computeGas < literalGas && computeGas <= copyGas)
+			{
+				representation->method = Representation::Method::Compute;
+				representation->routine = compute.execute(_assembly);
+			}
+			if (_cache)
+				_cache->store(move(cacheKey), *representation);
 		}
-		else if (computeGas < literalGas && computeGas <= copyGas)
+
+		AssemblyItems replacement;
+		switch (representation->method)
 		{
-			replacement = compute.execute(_assembly);
+		case Representation::Method::Literal:
+			break;
+		case Representation::Method::CodeCopy:
+			replacement = CodeCopyMethod(params, item.data()).execute(_assembly);
+			optimisations++;
+			break;
+		case Representation::Method::Compute:
+			replacement = representation->routine;
 			optimisations++;
+			break;
 		}
 		if (!replacement.empty())
 			pendingReplacements[item.data()] = replacement;
@@ -22,21 +22,50 @@
 
 #pragma once
 
+#include <libevmasm/AssemblyItem.h>
 #include <libevmasm/Exceptions.h>
 
 #include <liblangutil/EVMVersion.h>
 
 #include <libsolutil/Assertions.h>
 
+#include <map>
+#include <optional>
+#include <tuple>
 #include <vector>
 
 namespace solidity::evmasm
 {
 
-class AssemblyItem;
-using AssemblyItems = std::vector<AssemblyItem>;
 class Assembly;
 
+/**
+ * Representations chosen by the constant optimiser, to be reused for the same constants
+ * in other assemblies.
+ *
+ * The choice only depends on the constant and the parameters of the optimiser, so one cache
+ * can be shared by all assemblies of a compilation. It should not outlive the compilation.
+ */
+class ConstantOptimisationCache
+{
+public:
+	struct Representation
+	{
+		enum class Method { Literal, CodeCopy, Compute };
+		Method method = Method::Literal;
+		/// The routine computing the constant (only for Method::Compute).
+		AssemblyItems routine;
+	};
+	/// Value, multiplicity, creation flag, runs and EVM version.
+	using Key = std::tuple<u256, size_t, bool, size_t, langutil::EVMVersion>;
+
+	std::optional<Representation> find(Key const& _key) const;
+	void store(Key _key, Representation _representation);
+
+private:
+	std::map<Key, Representation> m_representations;
+};
+
 /**
  * Abstract base class for one way to change how constants are represented in the code.
  */
@@ -45,12 +74,14 @@ class ConstantOptimisationMethod
 public:
 	/// Tries to optimised how constants are represented in the source code and modifies
 	/// @a _assembly.
+	/// If @a _cache is given, the representations are looked up in and stored to it.
 	/// @returns zero if no optimisations could be performed.
 	static unsigned optimiseConstants(
 		bool _isCreation,
 		size_t _runs,
 		langutil::EVMVersion _evmVersion,
-		Assembly& _assembly
+		Assembly& _assembly,
+		ConstantOptimisationCache* _cache = nullptr
 	);
 
 protected:
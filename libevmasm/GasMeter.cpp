@@ -258,7 +258,7 @@ unsigned GasMeter::runGas(Instruction _instruction)
 	if (_instruction == Instruction::JUMPDEST)
 		return 1;
 
-	switch (instructionInfo(_instruction).gasPriceTier)
+	switch (instructionMetadata(_instruction).gasPriceTier)
 	{
 	case Tier::Zero:    return GasCosts::tier0Gas;
 	case Tier::Base:    return GasCosts::tier1Gas;
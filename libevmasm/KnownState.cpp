@@ -130,7 +130,7 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 	else
 	{
 		Instruction instruction = _item.instruction();
-		InstructionInfo info = instructionInfo(instruction);
+		InstructionMetadata const& info = instructionMetadata(instruction);
 		if (SemanticInformation::isDupInstruction(_item))
 			setStackElement(
 				m_stackHeight + 1,
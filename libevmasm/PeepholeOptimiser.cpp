@@ -129,9 +129,9 @@ struct OpPop: SimplePeepholeOptimizerMethod<OpPop, 2>
 		if (_pop == Instruction::POP && _op.type() == Operation)
 		{
 			Instruction instr = _op.instruction();
-			if (instructionInfo(instr).ret == 1 && !instructionInfo(instr).sideEffects)
+			if (instructionMetadata(instr).ret == 1 && !instructionMetadata(instr).sideEffects)
 			{
-				for (int j = 0; j < instructionInfo(instr).args; j++)
+				for (int j = 0; j < instructionMetadata(instr).args; j++)
 					*_out = {Instruction::POP, _op.location()};
 				return true;
 			}
@@ -51,6 +51,8 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::langutil;
@@ -102,19 +104,20 @@ string CharStream::lineAtPosition(int _position) const
 
 tuple<int, int> CharStream::translatePositionToLineColumn(int _position) const
 {
-	using size_type = string::size_type;
-	using diff_type = string::difference_type;
-	size_type searchPosition = min<size_type>(m_source.size(), size_type(_position));
-	int lineNumber = static_cast<int>(count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
+	if (m_lineStarts.empty())
 	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == string::npos ? 0 : lineStart + 1;
+		m_lineStarts.push_back(0);
+		for (size_t i = 0; i < m_source.size(); ++i)
+			if (m_source[i] == '\n')
+				m_lineStarts.push_back(i + 1);
 	}
-	return tuple<int, int>(lineNumber, searchPosition - lineStart);
+
+	size_t searchPosition = min<size_t>(m_source.size(), size_t(_position));
+	auto lineStart = prev(upper_bound(m_lineStarts.begin(), m_lineStarts.end(), searchPosition));
+	return tuple<int, int>(
+		static_cast<int>(lineStart - m_lineStarts.begin()),
+		static_cast<int>(searchPosition - *lineStart)
+	);
 }
 
 string_view CharStream::text(SourceLocation const& _location) const
@@ -54,6 +54,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -97,6 +98,9 @@ public:
 	/// Functions that help pretty-printing parse errors
 	/// Do only use in error cases, they are quite expensive.
 	std::string lineAtPosition(int _position) const;
+	/// Translates a position into zero-based line and column numbers.
+	/// Builds an index of line start offsets on first use, after which every
+	/// translation is a binary search.
 	std::tuple<int, int> translatePositionToLineColumn(int _position) const;
 	///@}
 
@@ -122,6 +126,8 @@ private:
 	std::string m_source;
 	std::string m_name;
 	size_t m_position{0};
+	/// Offsets of the first character of each line, lazily initialized.
+	mutable std::vector<size_t> m_lineStarts;
 };
 
 }
@@ -34,9 +34,29 @@ ErrorReporter& ErrorReporter::operator=(ErrorReporter const& _errorReporter)
 	if (&_errorReporter == this)
 		return *this;
 	m_errorList = _errorReporter.m_errorList;
+	m_deduplicate = _errorReporter.m_deduplicate;
+	m_reportedErrors = _errorReporter.m_reportedErrors;
 	return *this;
 }
 
+void ErrorReporter::append(ErrorList const& _errorList)
+{
+	for (auto const& error: _errorList)
+	{
+		SourceLocation const* location = boost::get_error_info<errinfo_sourceLocation>(*error);
+		SecondarySourceLocation const* secondaryLocation = boost::get_error_info<errinfo_secondarySourceLocation>(*error);
+		string const* description = error->comment();
+		if (!isDuplicate(
+			error->errorId(),
+			error->type(),
+			location ? *location : SourceLocation(),
+			secondaryLocation ? *secondaryLocation : SecondarySourceLocation(),
+			description ? *description : string()
+		))
+			m_errorList.push_back(error);
+	}
+}
+
 void ErrorReporter::warning(ErrorId _error, string const& _description)
 {
 	error(_error, Error::Type::Warning, SourceLocation(), _description);
@@ -63,6 +83,10 @@ void ErrorReporter::warning(
 
 void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation const& _location, string const& _description)
 {
+	if (warningLimitReached(_type))
+		return;
+	if (isDuplicate(_errorId, _type, _location, SecondarySourceLocation(), _description))
+		return;
 	if (checkForExcessiveErrors(_type))
 		return;
 
@@ -71,17 +95,45 @@ void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation co
 
 void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation const& _location, SecondarySourceLocation const& _secondaryLocation, string const& _description)
 {
+	if (warningLimitReached(_type))
+		return;
+	if (isDuplicate(_errorId, _type, _location, _secondaryLocation, _description))
+		return;
 	if (checkForExcessiveErrors(_type))
 		return;
 
 	m_errorList.push_back(make_shared<Error>(_errorId, _type, _description, _location, _secondaryLocation));
 }
 
+bool ErrorReporter::isDuplicate(
+	ErrorId _errorId,
+	Error::Type _type,
+	SourceLocation const& _location,
+	SecondarySourceLocation const& _secondaryLocation,
+	string const& _description
+)
+{
+	if (!m_deduplicate)
+		return false;
+	return !m_reportedErrors.emplace(
+		_errorId.error,
+		_type,
+		_location,
+		_description,
+		_secondaryLocation.infos
+	).second;
+}
+
 bool ErrorReporter::hasExcessiveErrors() const
 {
 	return m_errorCount > c_maxErrorsAllowed;
 }
 
+bool ErrorReporter::warningLimitReached(Error::Type _type) const
+{
+	return _type == Error::Type::Warning && m_warningCount >= c_maxWarningsAllowed;
+}
+
 bool ErrorReporter::checkForExcessiveErrors(Error::Type _type)
 {
 	if (_type == Error::Type::Warning)
@@ -128,6 +180,7 @@ ErrorList const& ErrorReporter::errors() const
 void ErrorReporter::clear()
 {
 	m_errorList.clear();
+	m_reportedErrors.clear();
 }
 
 void ErrorReporter::declarationError(ErrorId _error, SourceLocation const& _location, SecondarySourceLocation const& _secondaryLocation, string const& _description)
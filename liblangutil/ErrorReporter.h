@@ -32,6 +32,11 @@
 
 #include <boost/range/adaptor/filtered.hpp>
 
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
 namespace solidity::langutil
 {
 
@@ -43,14 +48,20 @@ public:
 		m_errorList(_errors) { }
 
 	ErrorReporter(ErrorReporter const& _errorReporter) noexcept:
-		m_errorList(_errorReporter.m_errorList) { }
+		m_errorList(_errorReporter.m_errorList),
+		m_deduplicate(_errorReporter.m_deduplicate),
+		m_reportedErrors(_errorReporter.m_reportedErrors)
+	{ }
 
 	ErrorReporter& operator=(ErrorReporter const& _errorReporter);
 
-	void append(ErrorList const& _errorList)
-	{
-		m_errorList += _errorList;
-	}
+	/// Appends the given errors, dropping duplicates if deduplication is enabled.
+	void append(ErrorList const& _errorList);
+
+	/// If enabled, errors and warnings that are identical to one already reported through
+	/// this reporter (same id, type, message and locations) are dropped and do not count
+	/// towards the error and warning limits.
+	void setDeduplication(bool _enabled) { m_deduplicate = _enabled; }
 
 	void warning(ErrorId _error, std::string const& _description);
 
@@ -179,8 +190,31 @@ private:
 	// @returns true if error shouldn't be stored
 	bool checkForExcessiveErrors(Error::Type _type);
 
+	/// @returns true if the limit for warnings is reached and a warning of type @a _type
+	/// would be dropped anyway.
+	bool warningLimitReached(Error::Type _type) const;
+
+	/// @returns true if deduplication is enabled and an identical error was reported before.
+	/// Otherwise records the error.
+	bool isDuplicate(
+		ErrorId _error,
+		Error::Type _type,
+		SourceLocation const& _location,
+		SecondarySourceLocation const& _secondaryLocation,
+		std::string const& _description
+	);
+
 	ErrorList& m_errorList;
 
+	bool m_deduplicate = false;
+	std::set<std::tuple<
+		unsigned long long,
+		Error::Type,
+		SourceLocation,
+		std::string,
+		std::vector<errorSourceLocationInfo>
+	>> m_reportedErrors;
+
 	unsigned m_errorCount = 0;
 	unsigned m_warningCount = 0;
 
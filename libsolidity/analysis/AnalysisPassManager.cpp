@@ -0,0 +1,94 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/analysis/AnalysisPassManager.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <libsolutil/Common.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+
+void AnalysisPassManager::addPass(
+	string _name,
+	vector<string> _dependencies,
+	function<bool()> _run,
+	function<bool()> _condition
+)
+{
+	solAssert(_run, "");
+	solAssert(!m_passIndices.count(_name), "Analysis pass \"" + _name + "\" registered twice.");
+
+	vector<size_t> dependencies;
+	for (string const& dependency: _dependencies)
+	{
+		auto it = m_passIndices.find(dependency);
+		solAssert(
+			it != m_passIndices.end(),
+			"Analysis pass \"" + _name + "\" depends on unknown pass \"" + dependency + "\"."
+		);
+		dependencies.push_back(it->second);
+	}
+
+	m_passIndices[_name] = m_passes.size();
+	m_passes.emplace_back(Pass{move(_name), move(dependencies), move(_run), move(_condition)});
+}
+
+bool AnalysisPassManager::run()
+{
+	m_executed.assign(m_passes.size(), false);
+	m_timings.clear();
+
+	for (size_t index = 0; index < m_passes.size(); ++index)
+	{
+		Pass const& pass = m_passes[index];
+		if (!all_of(
+			pass.dependencies.begin(),
+			pass.dependencies.end(),
+			[&](size_t _dependency) { return m_executed[_dependency]; }
+		))
+			continue;
+		if (pass.condition && !pass.condition())
+			continue;
+
+		auto start = chrono::steady_clock::now();
+		// Also record the time of a pass that stops the analysis with an exception.
+		ScopeGuard recordTiming([&]() {
+			m_timings.push_back({
+				pass.name,
+				chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start)
+			});
+		});
+		bool proceed = pass.run();
+		m_executed[index] = true;
+
+		if (!proceed)
+			return false;
+	}
+	return true;
+}
+
+bool AnalysisPassManager::hasRun(string const& _name) const
+{
+	auto it = m_passIndices.find(_name);
+	return it != m_passIndices.end() && it->second < m_executed.size() && m_executed[it->second];
+}
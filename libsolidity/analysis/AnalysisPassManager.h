@@ -0,0 +1,83 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Runs a sequence of named analysis passes with declared dependencies between them
+ * and records the time spent in each of them.
+ *
+ * Passes are executed in the order in which they were registered. A pass is skipped
+ * if its condition does not hold at the time it is reached or if any of its dependencies
+ * has been skipped. A pass can stop the whole analysis by returning false.
+ */
+class AnalysisPassManager
+{
+public:
+	struct Timing
+	{
+		std::string pass;
+		std::chrono::microseconds duration;
+	};
+
+	/// Registers a new pass. All dependencies have to be registered already.
+	/// @param _run executes the pass and returns false if the analysis has to be aborted.
+	/// @param _condition if provided, the pass is only run if it returns true.
+	void addPass(
+		std::string _name,
+		std::vector<std::string> _dependencies,
+		std::function<bool()> _run,
+		std::function<bool()> _condition = {}
+	);
+
+	/// Runs all registered passes.
+	/// @returns false if a pass aborted the analysis.
+	bool run();
+
+	/// @returns true if the pass with the given name was executed during the last call to @a run.
+	bool hasRun(std::string const& _name) const;
+
+	/// @returns the time spent in each executed pass, in order of execution.
+	/// Includes a pass that aborted the analysis by throwing.
+	std::vector<Timing> const& timings() const { return m_timings; }
+
+private:
+	struct Pass
+	{
+		std::string name;
+		std::vector<size_t> dependencies;
+		std::function<bool()> run;
+		std::function<bool()> condition;
+	};
+
+	std::vector<Pass> m_passes;
+	std::map<std::string, size_t> m_passIndices;
+	std::vector<bool> m_executed;
+	std::vector<Timing> m_timings;
+};
+
+}
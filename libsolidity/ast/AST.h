@@ -123,12 +123,16 @@ public:
 protected:
 	size_t const m_id = 0;
 
+	/// Creates the annotation of type @a T on first access and returns it.
+	/// Must only be called from the most derived override of @a annotation(), so that the
+	/// annotation is always created with and accessed as the same type. This allows
+	/// a static downcast on this hot path.
 	template <class T>
 	T& initAnnotation() const
 	{
 		if (!m_annotation)
 			m_annotation = std::make_unique<T>();
-		return dynamic_cast<T&>(*m_annotation);
+		return static_cast<T&>(*m_annotation);
 	}
 
 private:
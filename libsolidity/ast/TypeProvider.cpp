@@ -41,6 +41,8 @@ TupleType const TypeProvider::m_emptyTuple{};
 AddressType const TypeProvider::m_payableAddress{StateMutability::Payable};
 AddressType const TypeProvider::m_address{StateMutability::NonPayable};
 
+mutex TypeProvider::m_memberListMutex;
+
 array<unique_ptr<IntegerType>, 32> const TypeProvider::m_intM{{
 	{make_unique<IntegerType>(8 * 1, IntegerType::Modifier::Signed)},
 	{make_unique<IntegerType>(8 * 2, IntegerType::Modifier::Signed)},
@@ -195,6 +197,10 @@ void TypeProvider::reset()
 	instance().m_stringLiteralTypes.clear();
 	instance().m_ufixedMxN.clear();
 	instance().m_fixedMxN.clear();
+
+	lock_guard<mutex> lock(m_memberListMutex);
+	instance().m_memberLists.clear();
+	instance().m_memberListStatistics = {};
 }
 
 template <typename T, typename... Args>
@@ -577,3 +583,36 @@ MappingType const* TypeProvider::mapping(Type const* _keyType, Type const* _valu
 {
 	return createAndGet<MappingType>(_keyType, _valueType);
 }
+
+shared_ptr<MemberList const> TypeProvider::sharedMemberList(
+	string const& _richIdentifier,
+	ASTNode const* _scope,
+	std::function<MemberList::MemberMap()> const& _computeMembers
+)
+{
+	TypeProvider& provider = instance();
+	auto key = make_pair(_richIdentifier, _scope);
+	{
+		lock_guard<mutex> lock(m_memberListMutex);
+		auto it = provider.m_memberLists.find(key);
+		if (it != provider.m_memberLists.end())
+		{
+			++provider.m_memberListStatistics.hits;
+			return it->second;
+		}
+		++provider.m_memberListStatistics.misses;
+	}
+
+	// Computing the members can request members of other types, so the lock
+	// must not be held here.
+	auto members = make_shared<MemberList const>(_computeMembers());
+
+	lock_guard<mutex> lock(m_memberListMutex);
+	return provider.m_memberLists.emplace(move(key), move(members)).first->second;
+}
+
+TypeProvider::MemberListCacheStatistics TypeProvider::memberListCacheStatistics()
+{
+	lock_guard<mutex> lock(m_memberListMutex);
+	return instance().m_memberListStatistics;
+}
@@ -21,8 +21,10 @@
 #include <libsolidity/ast/Types.h>
 
 #include <array>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 
@@ -201,6 +203,24 @@ public:
 
 	static MappingType const* mapping(Type const* _keyType, Type const* _valueType);
 
+	struct MemberListCacheStatistics
+	{
+		size_t hits = 0;
+		size_t misses = 0;
+	};
+
+	/// @returns the member list shared by all types with the rich identifier @a _richIdentifier
+	/// when accessed from @a _scope. If it is not cached yet, it is computed using @a _computeMembers.
+	/// Safe to call concurrently.
+	static std::shared_ptr<MemberList const> sharedMemberList(
+		std::string const& _richIdentifier,
+		ASTNode const* _scope,
+		std::function<MemberList::MemberMap()> const& _computeMembers
+	);
+
+	/// @returns the number of cache hits and misses of @a sharedMemberList since the last reset.
+	static MemberListCacheStatistics memberListCacheStatistics();
+
 private:
 	/// Global TypeProvider instance.
 	static TypeProvider& instance()
@@ -234,6 +254,10 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+
+	static std::mutex m_memberListMutex;
+	std::map<std::pair<std::string, ASTNode const*>, std::shared_ptr<MemberList const>> m_memberLists{};
+	MemberListCacheStatistics m_memberListStatistics{};
 };
 
 }
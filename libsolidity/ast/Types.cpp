@@ -293,10 +293,16 @@ MemberList const& Type::members(ASTNode const* _currentScope) const
 			dynamic_cast<SourceUnit const*>(_currentScope) ||
 			dynamic_cast<ContractDefinition const*>(_currentScope),
 		"");
-		MemberList::MemberMap members = nativeMembers(_currentScope);
-		if (_currentScope)
-			members += boundFunctions(*this, *_currentScope);
-		m_members[_currentScope] = make_unique<MemberList>(move(members));
+		auto computeMembers = [&]() {
+			MemberList::MemberMap members = nativeMembers(_currentScope);
+			if (_currentScope)
+				members += boundFunctions(*this, *_currentScope);
+			return members;
+		};
+		if (canShareMembers())
+			m_members[_currentScope] = TypeProvider::sharedMemberList(richIdentifier(), _currentScope, computeMembers);
+		else
+			m_members[_currentScope] = make_shared<MemberList const>(computeMembers());
 	}
 	return *m_members[_currentScope];
 }
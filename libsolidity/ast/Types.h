@@ -390,8 +390,13 @@ protected:
 	}
 
 
+	/// @returns true if all types with the same rich identifier have the same members, so that
+	/// member lists can be shared between them through the cache in TypeProvider.
+	virtual bool canShareMembers() const { return true; }
+
 	/// List of member types (parameterised by scape), will be lazy-initialized.
-	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
+	/// The lists are shared with all equal types if @a canShareMembers is true.
+	mutable std::map<ASTNode const*, std::shared_ptr<MemberList const>> m_members;
 	mutable std::optional<std::vector<std::tuple<std::string, Type const*>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
 };
@@ -1275,6 +1280,8 @@ public:
 	Type const* encodingType() const override;
 	TypeResult interfaceType(bool _inLibrary) const override;
 	Type const* mobileType() const override;
+	/// The members depend on the referenced declaration, which is not part of the identifier.
+	bool canShareMembers() const override { return false; }
 
 	/// @returns Type const* of a new FunctionType object. All input/return parameters are an
 	/// appropriate external types (i.e. the interfaceType()s) of input/return parameters of
@@ -37,11 +37,25 @@ namespace solidity::frontend
 class Compiler
 {
 public:
-	Compiler(langutil::EVMVersion _evmVersion, RevertStrings _revertStrings, OptimiserSettings _optimiserSettings):
+	Compiler(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<MultiUseYulFunctionCollector::SharedFunctions> _sharedYulFunctions = {},
+		std::shared_ptr<InlineAssemblyCache> _inlineAssemblyCache = {},
+		std::shared_ptr<evmasm::ConstantOptimisationCache> _constantOptimisationCache = {}
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
 		m_runtimeContext(_evmVersion, _revertStrings),
 		m_context(_evmVersion, _revertStrings, &m_runtimeContext)
-	{ }
+	{
+		m_runtimeContext.setSharedYulFunctions(_sharedYulFunctions);
+		m_context.setSharedYulFunctions(std::move(_sharedYulFunctions));
+		m_runtimeContext.setInlineAssemblyCache(_inlineAssemblyCache);
+		m_context.setInlineAssemblyCache(std::move(_inlineAssemblyCache));
+		m_runtimeContext.setConstantOptimisationCache(_constantOptimisationCache);
+		m_context.setConstantOptimisationCache(std::move(_constantOptimisationCache));
+	}
 
 	/// Compiles a contract.
 	/// @arg _metadata contains the to be injected metadata CBOR
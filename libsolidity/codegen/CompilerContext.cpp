@@ -432,18 +432,83 @@ void CompilerContext::appendInlineAssembly(
 		}
 	};
 
-	ErrorList errors;
-	ErrorReporter errorReporter(errors);
-	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, _sourceName));
 	yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
 	optional<langutil::SourceLocation> locationOverride;
 	if (!_system)
 		locationOverride = m_asm->currentSourceLocation();
+
+	InlineAssemblyCache::Key cacheKey{
+		_assembly,
+		_sourceName,
+		_localVariables,
+		_externallyUsedFunctions,
+		_system,
+		runtimeContext() != nullptr,
+		locationOverride,
+		m_evmVersion.name(),
+		_optimiserSettings.runYulOptimiser,
+		_optimiserSettings.optimizeStackAllocation,
+		_optimiserSettings.yulOptimiserSteps,
+		_optimiserSettings.expectedExecutionsPerDeployment,
+		_optimiserSettings.reasoningBasedSimplifierMaxChecks
+	};
+	InlineAssemblyCache::Entry const* cached =
+		m_inlineAssemblyCache ? util::valueOrNullptr(m_inlineAssemblyCache->entries, cacheKey) : nullptr;
+	InlineAssemblyCache::Entry entry = cached ? *cached : parseAndOptimizeInlineAssembly(
+		_assembly,
+		_localVariables,
+		externallyUsedIdentifiers,
+		_system,
+		_optimiserSettings,
+		_sourceName,
+		dialect,
+		move(locationOverride),
+		identifierAccess.resolve
+	);
+	if (m_inlineAssemblyCache && !cached)
+		m_inlineAssemblyCache->entries.emplace(move(cacheKey), entry);
+
+	if (_system)
+	{
+		solAssert(m_generatedYulUtilityCode.empty(), "");
+		m_generatedYulUtilityCode = entry.generatedCode;
+	}
+
+	yul::CodeGenerator::assemble(
+		*entry.code,
+		*entry.analysisInfo,
+		*m_asm,
+		m_evmVersion,
+		identifierAccess,
+		_system,
+		_optimiserSettings.optimizeStackAllocation
+	);
+
+	// Reset the source location to the one of the node (instead of the CODEGEN source location)
+	updateSourceLocation();
+}
+
+
+InlineAssemblyCache::Entry CompilerContext::parseAndOptimizeInlineAssembly(
+	string const& _assembly,
+	vector<string> const& _localVariables,
+	set<yul::YulString> const& _externallyUsedIdentifiers,
+	bool _system,
+	OptimiserSettings const& _optimiserSettings,
+	string const& _sourceName,
+	yul::EVMDialect const& _dialect,
+	optional<langutil::SourceLocation> _locationOverride,
+	yul::ExternalIdentifierAccess::Resolver const& _resolver
+)
+{
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, _sourceName));
 	shared_ptr<yul::Block> parserResult =
-		yul::Parser(errorReporter, dialect, std::move(locationOverride))
+		yul::Parser(errorReporter, _dialect, std::move(_locationOverride))
 		.parse(scanner, false);
 #ifdef SOL_OUTPUT_ASM
-	cout << yul::AsmPrinter(&dialect)(*parserResult) << endl;
+	cout << yul::AsmPrinter(&_dialect)(*parserResult) << endl;
 #endif
 
 	auto reportError = [&](string const& _context)
@@ -463,73 +528,57 @@ void CompilerContext::appendInlineAssembly(
 		solAssert(false, message);
 	};
 
-	yul::AsmAnalysisInfo analysisInfo;
+	auto analysisInfo = make_shared<yul::AsmAnalysisInfo>();
 	bool analyzerResult = false;
 	if (parserResult)
 		analyzerResult = yul::AsmAnalyzer(
-			analysisInfo,
+			*analysisInfo,
 			errorReporter,
-			dialect,
-			identifierAccess.resolve
+			_dialect,
+			_resolver
 		).analyze(*parserResult);
 	if (!parserResult || !errorReporter.errors().empty() || !analyzerResult)
 		reportError("Invalid assembly generated by code generator.");
 
+	string generatedCode;
 	// Several optimizer steps cannot handle externally supplied stack variables,
 	// so we essentially only optimize the ABI functions.
 	if (_optimiserSettings.runYulOptimiser && _localVariables.empty())
 	{
 		yul::Object obj;
 		obj.code = parserResult;
-		obj.analysisInfo = make_shared<yul::AsmAnalysisInfo>(analysisInfo);
+		obj.analysisInfo = analysisInfo;
 
-		optimizeYul(obj, dialect, _optimiserSettings, externallyUsedIdentifiers);
+		optimizeYul(obj, _dialect, _optimiserSettings, _externallyUsedIdentifiers);
 
 		if (_system)
 		{
 			// Store as generated sources, but first re-parse to update the source references.
-			solAssert(m_generatedYulUtilityCode.empty(), "");
-			m_generatedYulUtilityCode = yul::AsmPrinter(dialect)(*obj.code);
-			string code = yul::AsmPrinter{dialect}(*obj.code);
-			scanner = make_shared<langutil::Scanner>(langutil::CharStream(m_generatedYulUtilityCode, _sourceName));
-			obj.code = yul::Parser(errorReporter, dialect).parse(scanner, false);
-			*obj.analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(dialect, obj);
+			generatedCode = yul::AsmPrinter(_dialect)(*obj.code);
+			scanner = make_shared<langutil::Scanner>(langutil::CharStream(generatedCode, _sourceName));
+			obj.code = yul::Parser(errorReporter, _dialect).parse(scanner, false);
+			*obj.analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, obj);
 		}
 
-		analysisInfo = std::move(*obj.analysisInfo);
+		analysisInfo = std::move(obj.analysisInfo);
 		parserResult = std::move(obj.code);
 
 #ifdef SOL_OUTPUT_ASM
 		cout << "After optimizer:" << endl;
-		cout << yul::AsmPrinter(&dialect)(*parserResult) << endl;
+		cout << yul::AsmPrinter(&_dialect)(*parserResult) << endl;
 #endif
 	}
 	else if (_system)
-	{
 		// Store as generated source.
-		solAssert(m_generatedYulUtilityCode.empty(), "");
-		m_generatedYulUtilityCode = _assembly;
-	}
+		generatedCode = _assembly;
 
 	if (!errorReporter.errors().empty())
 		reportError("Failed to analyze inline assembly block.");
 
 	solAssert(errorReporter.errors().empty(), "Failed to analyze inline assembly block.");
-	yul::CodeGenerator::assemble(
-		*parserResult,
-		analysisInfo,
-		*m_asm,
-		m_evmVersion,
-		identifierAccess,
-		_system,
-		_optimiserSettings.optimizeStackAllocation
-	);
-
-	// Reset the source location to the one of the node (instead of the CODEGEN source location)
-	updateSourceLocation();
+	return {std::move(parserResult), std::move(analysisInfo), std::move(generatedCode)};
 }
 
-
 void CompilerContext::optimizeYul(yul::Object& _object, yul::EVMDialect const& _dialect, OptimiserSettings const& _optimiserSettings, std::set<yul::YulString> const& _externalIdentifiers)
 {
 #ifdef SOL_OUTPUT_ASM
@@ -545,7 +594,8 @@ void CompilerContext::optimizeYul(yul::Object& _object, yul::EVMDialect const& _
 		_optimiserSettings.optimizeStackAllocation,
 		_optimiserSettings.yulOptimiserSteps,
 		isCreation? nullopt : make_optional(_optimiserSettings.expectedExecutionsPerDeployment),
-		_externalIdentifiers
+		_externalIdentifiers,
+		_optimiserSettings.reasoningBasedSimplifierMaxChecks
 	);
 
 #ifdef SOL_OUTPUT_ASM
@@ -571,7 +621,7 @@ void CompilerContext::updateSourceLocation()
 evmasm::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(OptimiserSettings const& _settings)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	evmasm::Assembly::OptimiserSettings asmSettings{false, false,  false, false, false, false, false, m_evmVersion, 0};
+	evmasm::Assembly::OptimiserSettings asmSettings{false, false,  false, false, false, false, false, m_evmVersion, 0, nullptr};
 	asmSettings.isCreation = true;
 	asmSettings.runInliner = _settings.runInliner;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
@@ -581,6 +631,7 @@ evmasm::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(
 	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
 	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
 	asmSettings.evmVersion = m_evmVersion;
+	asmSettings.constantOptimisationCache = m_constantOptimisationCache;
 	return asmSettings;
 }
 
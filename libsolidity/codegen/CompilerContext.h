@@ -42,9 +42,14 @@
 #include <libyul/backends/evm/EVMDialect.h>
 
 #include <functional>
+#include <map>
+#include <memory>
+#include <optional>
 #include <ostream>
+#include <set>
 #include <stack>
 #include <queue>
+#include <tuple>
 #include <utility>
 
 namespace solidity::frontend
@@ -52,6 +57,40 @@ namespace solidity::frontend
 
 class Compiler;
 
+/**
+ * Parsed, analyzed and (if requested) optimized inline assembly blocks.
+ * Can be shared between the compiler contexts of all contracts of a compilation.
+ */
+struct InlineAssemblyCache
+{
+	/// Everything the result of parsing, analyzing and optimizing an inline assembly block depends on:
+	/// Code, source name, local variables, externally used functions, system flag, creation flag,
+	/// source location override, EVM version and the relevant optimiser settings.
+	using Key = std::tuple<
+		std::string,
+		std::string,
+		std::vector<std::string>,
+		std::set<std::string>,
+		bool,
+		bool,
+		std::optional<langutil::SourceLocation>,
+		std::string,
+		bool,
+		bool,
+		std::string,
+		size_t,
+		size_t
+	>;
+	struct Entry
+	{
+		std::shared_ptr<yul::Block const> code;
+		std::shared_ptr<yul::AsmAnalysisInfo> analysisInfo;
+		/// Code to be stored as generated Yul utility code (only for system assembly).
+		std::string generatedCode;
+	};
+	std::map<Key, Entry> entries;
+};
+
 /**
  * Context to be shared by all units that compile the same contract.
  * It stores the generated bytecode and the position of identifiers in memory and on the stack.
@@ -166,6 +205,19 @@ public:
 	void appendMissingLowLevelFunctions();
 	ABIFunctions& abiFunctions() { return m_abiFunctions; }
 	YulUtilFunctions& utilFunctions() { return m_yulUtilFunctions; }
+	/// Sets the cache of inline assembly blocks shared with the contexts of other contracts.
+	void setInlineAssemblyCache(std::shared_ptr<InlineAssemblyCache> _cache) { m_inlineAssemblyCache = std::move(_cache); }
+	/// Sets the cache of the constant optimiser shared with the contexts of other contracts.
+	void setConstantOptimisationCache(std::shared_ptr<evmasm::ConstantOptimisationCache> _cache)
+	{
+		m_constantOptimisationCache = std::move(_cache);
+	}
+
+	/// Sets the Yul utility functions shared with the contexts of other contracts.
+	void setSharedYulFunctions(std::shared_ptr<MultiUseYulFunctionCollector::SharedFunctions> _sharedFunctions)
+	{
+		m_yulFunctionCollector.setSharedFunctions(std::move(_sharedFunctions));
+	}
 
 	/// Appends concatenation of all generated Yul functions to the bytecode
 	/// and stores the Yul source code to be returned by @a generatedYulUtilityCode.
@@ -315,6 +367,19 @@ private:
 
 	evmasm::Assembly::OptimiserSettings translateOptimiserSettings(OptimiserSettings const& _settings);
 
+	/// Parses, analyzes and (if requested) optimizes an inline assembly block for appendInlineAssembly.
+	InlineAssemblyCache::Entry parseAndOptimizeInlineAssembly(
+		std::string const& _assembly,
+		std::vector<std::string> const& _localVariables,
+		std::set<yul::YulString> const& _externallyUsedIdentifiers,
+		bool _system,
+		OptimiserSettings const& _optimiserSettings,
+		std::string const& _sourceName,
+		yul::EVMDialect const& _dialect,
+		std::optional<langutil::SourceLocation> _locationOverride,
+		yul::ExternalIdentifierAccess::Resolver const& _resolver
+	);
+
 	/**
 	 * Helper class that manages function labels and ensures that referenced functions are
 	 * compiled in a specific order.
@@ -386,6 +451,10 @@ private:
 	/// Generated Yul code used as utility. Source references from the bytecode can point here.
 	/// Produced from @a m_yulFunctionCollector.
 	std::string m_generatedYulUtilityCode;
+	/// Already processed inline assembly blocks, possibly shared with other contexts.
+	std::shared_ptr<InlineAssemblyCache> m_inlineAssemblyCache;
+	/// Representations chosen by the constant optimiser, possibly shared with other contexts.
+	std::shared_ptr<evmasm::ConstantOptimisationCache> m_constantOptimisationCache;
 	/// Container for ABI functions to be generated.
 	ABIFunctions m_abiFunctions;
 	/// Container for Yul Util functions to be generated.
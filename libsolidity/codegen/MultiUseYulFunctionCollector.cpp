@@ -23,6 +23,7 @@
 #include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 
 #include <liblangutil/Exceptions.h>
+#include <libsolutil/CommonData.h>
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
 
@@ -44,34 +45,32 @@ string MultiUseYulFunctionCollector::requestedFunctions()
 	return result;
 }
 
-string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
+namespace
 {
-	if (!m_requestedFunctions.count(_name))
-	{
-		m_requestedFunctions[_name] = "<<STUB<<";
+
+function<string()> checkedFunctionCreator(string const& _name, function<string()> const& _creator)
+{
+	return [&]() {
 		string fun = _creator();
 		solAssert(!fun.empty(), "");
 		solAssert(fun.find("function " + _name + "(") != string::npos, "Function not properly named.");
-		m_requestedFunctions[_name] = std::move(fun);
-	}
-	return _name;
+		return fun;
+	};
 }
 
-string MultiUseYulFunctionCollector::createFunction(
+function<string()> functionFromBodyCreator(
 	string const& _name,
 	function<string(vector<string>&, vector<string>&)> const& _creator
 )
 {
 	solAssert(!_name.empty(), "");
-	if (!m_requestedFunctions.count(_name))
-	{
-		m_requestedFunctions[_name] = "<<STUB<<";
+	return [&]() {
 		vector<string> arguments;
 		vector<string> returnParameters;
 		string body = _creator(arguments, returnParameters);
 		solAssert(!body.empty(), "");
 
-		m_requestedFunctions[_name] = Whiskers(R"(
+		return Whiskers(R"(
 			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
 				<body>
 			}
@@ -80,7 +79,92 @@ string MultiUseYulFunctionCollector::createFunction(
 		("args", joinHumanReadable(arguments))
 		("retParams", joinHumanReadable(returnParameters))
 		("body", body)
-		.render();;
+		.render();
+	};
+}
+
+}
+
+optional<MultiUseYulFunctionCollector::SharedFunctions::Function>
+MultiUseYulFunctionCollector::SharedFunctions::find(string const& _name) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	if (Function const* function = valueOrNullptr(m_functions, _name))
+		return *function;
+	return nullopt;
+}
+
+void MultiUseYulFunctionCollector::SharedFunctions::store(string const& _name, Function _function)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_functions.emplace(_name, move(_function));
+}
+
+string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
+{
+	return create(_name, checkedFunctionCreator(_name, _creator), false);
+}
+
+string MultiUseYulFunctionCollector::createFunction(
+	string const& _name,
+	function<string(vector<string>&, vector<string>&)> const& _creator
+)
+{
+	return create(_name, functionFromBodyCreator(_name, _creator), false);
+}
+
+string MultiUseYulFunctionCollector::createSharedFunction(string const& _name, function<string ()> const& _creator)
+{
+	return create(_name, checkedFunctionCreator(_name, _creator), true);
+}
+
+string MultiUseYulFunctionCollector::createSharedFunction(
+	string const& _name,
+	function<string(vector<string>&, vector<string>&)> const& _creator
+)
+{
+	return create(_name, functionFromBodyCreator(_name, _creator), true);
+}
+
+string MultiUseYulFunctionCollector::create(string const& _name, function<string()> const& _creator, bool _shared)
+{
+	if (m_dependencies)
+		m_dependencies->push_back(_name);
+	if (m_requestedFunctions.count(_name))
+		return _name;
+
+	bool const shared = _shared && m_sharedFunctions;
+	if (shared && addSharedFunction(_name))
+		return _name;
+
+	m_requestedFunctions[_name] = "<<STUB<<";
+	vector<string> dependencies;
+	string fun;
+	{
+		ScopedSaveAndRestore dependencyRecorder(m_dependencies, shared ? &dependencies : nullptr);
+		fun = _creator();
 	}
+	if (shared)
+		m_sharedFunctions->store(_name, {fun, move(dependencies)});
+	m_requestedFunctions[_name] = move(fun);
 	return _name;
 }
+
+bool MultiUseYulFunctionCollector::addSharedFunction(string const& _name)
+{
+	if (m_requestedFunctions.count(_name))
+		return true;
+
+	optional<SharedFunctions::Function> function = m_sharedFunctions->find(_name);
+	if (!function)
+		return false;
+
+	m_requestedFunctions[_name] = move(function->code);
+	for (string const& dependency: function->dependencies)
+		if (!addSharedFunction(dependency))
+		{
+			m_requestedFunctions.erase(_name);
+			return false;
+		}
+	return true;
+}
@@ -24,7 +24,11 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -36,6 +40,36 @@ namespace solidity::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	/**
+	 * Functions that only depend on their name and the compiler settings. They can be shared
+	 * between the collectors of all contracts that are compiled with the same settings.
+	 * Thread-safe.
+	 */
+	class SharedFunctions
+	{
+	public:
+		struct Function
+		{
+			std::string code;
+			/// Names of the multi-use functions requested while creating @a code.
+			std::vector<std::string> dependencies;
+		};
+
+		/// @returns a copy of the function called @a _name, if it has been stored.
+		std::optional<Function> find(std::string const& _name) const;
+		void store(std::string const& _name, Function _function);
+
+	private:
+		mutable std::mutex m_mutex;
+		std::map<std::string, Function> m_functions;
+	};
+
+	/// Makes @a createSharedFunction take functions from @a _sharedFunctions and store them there.
+	void setSharedFunctions(std::shared_ptr<SharedFunctions> _sharedFunctions)
+	{
+		m_sharedFunctions = std::move(_sharedFunctions);
+	}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -46,6 +80,17 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Same as @a createFunction, but for functions whose code only depends on their name and the
+	/// compiler settings, i.e. @a _creator has no side effects apart from requesting other
+	/// such functions. These are taken from the shared functions (see @a setSharedFunctions),
+	/// including the functions they depend on, instead of calling @a _creator.
+	std::string createSharedFunction(std::string const& _name, std::function<std::string()> const& _creator);
+
+	std::string createSharedFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
 	/// @returns concatenation of all generated functions.
 	/// Guarantees that the order of functions in the generated code is deterministic and
 	/// platform-independent.
@@ -57,8 +102,19 @@ public:
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
 private:
+	/// Adds the function @a _name using @a _creator (which returns the complete code)
+	/// unless it has already been added.
+	std::string create(std::string const& _name, std::function<std::string()> const& _creator, bool _shared);
+
+	/// Adds the function @a _name and its dependencies from the shared functions.
+	/// @returns false if the function or one of its dependencies is not available there.
+	bool addSharedFunction(std::string const& _name);
+
 	/// Map from function name to code for a multi-use function.
 	std::map<std::string, std::string> m_requestedFunctions;
+	std::shared_ptr<SharedFunctions> m_sharedFunctions;
+	/// Receives the names of the functions requested by the creator of a shared function.
+	std::vector<std::string>* m_dependencies = nullptr;
 };
 
 }
@@ -86,15 +86,17 @@ set<CallableDeclaration const*, ASTNode::CompareByID> collectReachableCallables(
 
 }
 
-pair<string, string> IRGenerator::run(
+pair<string, shared_ptr<yul::Object const>> IRGenerator::run(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
-	map<ContractDefinition const*, string_view const> const& _otherYulSources
+	map<ContractDefinition const*, string_view const> const& _otherYulSources,
+	shared_ptr<yul::OptimizedSubObjectCache> _optimizedSubObjects
 )
 {
 	string const ir = yul::reindent(generate(_contract, _cborMetadata, _otherYulSources));
 
 	yul::AssemblyStack asmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
+	asmStack.setOptimizedSubObjectCache(move(_optimizedSubObjects));
 	if (!asmStack.parseAndAnalyze("", ir))
 	{
 		string errorMessage;
@@ -107,15 +109,19 @@ pair<string, string> IRGenerator::run(
 	}
 	asmStack.optimize();
 
-	string warning =
+	return {warningMessage() + ir, asmStack.parserResult()};
+}
+
+string const& IRGenerator::warningMessage()
+{
+	static string const warning =
 		"/*=====================================================*\n"
 		" *                       WARNING                       *\n"
 		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
 		" *       It can result in LOSS OF FUNDS or worse       *\n"
 		" *                !USE AT YOUR OWN RISK!               *\n"
 		" *=====================================================*/\n\n";
-
-	return {warning + ir, warning + asmStack.print()};
+	return warning;
 }
 
 string IRGenerator::generate(
@@ -29,8 +29,15 @@
 #include <libsolidity/codegen/ir/IRGenerationContext.h>
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <liblangutil/EVMVersion.h>
+#include <memory>
 #include <string>
 
+namespace solidity::yul
+{
+struct Object;
+struct OptimizedSubObjectCache;
+}
+
 namespace solidity::frontend
 {
 
@@ -43,22 +50,30 @@ public:
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
 		OptimiserSettings _optimiserSettings,
-		std::map<std::string, unsigned> _sourceIndices
+		std::map<std::string, unsigned> _sourceIndices,
+		std::shared_ptr<MultiUseYulFunctionCollector::SharedFunctions> _sharedFunctions = {}
 	):
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(_optimiserSettings),
 		m_context(_evmVersion, _revertStrings, std::move(_optimiserSettings), std::move(_sourceIndices)),
 		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector())
-	{}
-
-	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(
+	{
+		m_context.functionCollector().setSharedFunctions(std::move(_sharedFunctions));
+	}
+
+	/// Generates and returns the IR code, in unoptimized form as text and in optimized form
+	/// (or just parsed, depending on the optimizer settings) as an analyzed Yul object.
+	/// Sub-objects of other contracts are taken from @a _optimizedSubObjects if present.
+	std::pair<std::string, std::shared_ptr<yul::Object const>> run(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
-		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources,
+		std::shared_ptr<yul::OptimizedSubObjectCache> _optimizedSubObjects = {}
 	);
 
+	/// @returns the warning that is prepended to the textual IR outputs.
+	static std::string const& warningMessage();
+
 private:
 	std::string generate(
 		ContractDefinition const& _contract,
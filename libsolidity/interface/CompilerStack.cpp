@@ -65,10 +65,13 @@
 #include <libyul/AssemblyStack.h>
 #include <libyul/AST.h>
 #include <libyul/AsmParser.h>
+#include <libyul/Object.h>
+#include <libyul/backends/evm/EVMDialect.h>
 
 #include <liblangutil/Scanner.h>
 #include <liblangutil/SemVerHandler.h>
 
+#include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/Exceptions.h>
 
 #include <libsolutil/SwarmHash.h>
@@ -101,6 +104,8 @@ CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
 	// no more than one entity is actually using it at a time.
 	solAssert(g_compilerStackCounts == 0, "You shall not have another CompilerStack aside me.");
 	++g_compilerStackCounts;
+
+	m_errorReporter.setDeduplication(true);
 }
 
 CompilerStack::~CompilerStack()
@@ -300,8 +305,14 @@ void CompilerStack::reset(bool _keepSettings)
 		m_stopAfter = State::CompilationSuccessful;
 	}
 	m_globalContext.reset();
+	m_analysisTimings.clear();
 	m_sourceOrder.clear();
 	m_contracts.clear();
+	m_sharedYulFunctions.reset();
+	m_inlineAssemblyCache.reset();
+	m_constantOptimisationCache.reset();
+	m_irSubObjectCache.reset();
+	m_backendSubObjectCache.reset();
 	m_errorReporter.clear();
 	TypeProvider::reset();
 }
@@ -366,11 +377,11 @@ bool CompilerStack::parse()
 	return !m_hasError;
 }
 
-void CompilerStack::importASTs(map<string, Json::Value> const& _sources)
+void CompilerStack::importASTs(map<string, Json::Value> _sources)
 {
 	if (m_stackState != Empty)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call importASTs only before the SourcesSet state."));
-	m_sourceJsons = _sources;
+	m_sourceJsons = move(_sources);
 	map<string, ASTPointer<SourceUnit>> reconstructedSources = ASTJsonImporter(m_evmVersion).jsonToSourceUnit(m_sourceJsons);
 	for (auto& src: reconstructedSources)
 	{
@@ -399,65 +410,100 @@ bool CompilerStack::analyze()
 			Scoper::assignScopes(*source->ast);
 
 	bool noErrors = true;
+	auto const forEachSource = [&](auto&& _check) {
+		bool success = true;
+		for (Source const* source: m_sourceOrder)
+			if (source->ast && !_check(*source->ast))
+				success = false;
+		return success;
+	};
+	auto const noErrorsSoFar = [&]() { return noErrors; };
 
 	try
 	{
 		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
-				noErrors = false;
-
 		m_globalContext = make_shared<GlobalContext>();
 		// We need to keep the same resolver during the whole process.
 		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.registerDeclarations(*source->ast))
-				return false;
+		DocStringTagParser docStringTagParser(m_errorReporter);
+		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
+		ContractLevelChecker contractLevelChecker(m_errorReporter);
+		DocStringAnalyser docStringAnalyser(m_errorReporter);
+		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
+		PostTypeChecker postTypeChecker(m_errorReporter);
+		CFG cfg(m_errorReporter);
 
-		map<string, SourceUnit const*> sourceUnitsByName;
-		for (auto& source: m_sources)
-			sourceUnitsByName[source.first] = source.second.ast.get();
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
-				return false;
+		AnalysisPassManager passes;
+		// Keep the timings also if a pass stops the analysis with a fatal error.
+		ScopeGuard storeTimings([&]() { m_analysisTimings = passes.timings(); });
 
-		resolver.warnHomonymDeclarations();
+		passes.addPass("SyntaxChecker", {}, [&]() {
+			if (!forEachSource([&](SourceUnit const& _ast) { return syntaxChecker.checkSyntax(_ast); }))
+				noErrors = false;
+			return true;
+		});
 
-		DocStringTagParser docStringTagParser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !docStringTagParser.parseDocStrings(*source->ast))
+		passes.addPass("DeclarationRegistration", {}, [&]() {
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.registerDeclarations(*source->ast))
+					return false;
+			return true;
+		});
+
+		passes.addPass("ImportResolution", {"DeclarationRegistration"}, [&]() {
+			map<string, SourceUnit const*> sourceUnitsByName;
+			for (auto& source: m_sources)
+				sourceUnitsByName[source.first] = source.second.ast.get();
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
+					return false;
+
+			resolver.warnHomonymDeclarations();
+			return true;
+		});
+
+		passes.addPass("DocStringTagParser", {}, [&]() {
+			if (!forEachSource([&](SourceUnit const& _ast) { return docStringTagParser.parseDocStrings(_ast); }))
 				noErrors = false;
+			return true;
+		});
 
-		// Requires DocStringTagParser
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
-				return false;
+		passes.addPass("NameAndTypeResolver", {"ImportResolution", "DocStringTagParser"}, [&]() {
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
+					return false;
+			return true;
+		});
 
-		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !declarationTypeChecker.check(*source->ast))
-				return false;
+		passes.addPass("DeclarationTypeChecker", {"NameAndTypeResolver"}, [&]() {
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !declarationTypeChecker.check(*source->ast))
+					return false;
+			return true;
+		});
 
-		// Requires DeclarationTypeChecker to have run
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !docStringTagParser.validateDocStringsUsingTypes(*source->ast))
+		passes.addPass("DocStringTypeValidation", {"DeclarationTypeChecker"}, [&]() {
+			if (!forEachSource([&](SourceUnit const& _ast) { return docStringTagParser.validateDocStringsUsingTypes(_ast); }))
 				noErrors = false;
+			return true;
+		});
 
 		// Next, we check inheritance, overrides, function collisions and other things at
 		// contract or function level.
 		// This also calculates whether a contract is abstract, which is needed by the
 		// type checker.
-		ContractLevelChecker contractLevelChecker(m_errorReporter);
-
-		for (Source const* source: m_sourceOrder)
-			if (auto sourceAst = source->ast)
-				noErrors = contractLevelChecker.check(*sourceAst);
+		passes.addPass("ContractLevelChecker", {"DeclarationTypeChecker"}, [&]() {
+			for (Source const* source: m_sourceOrder)
+				if (auto sourceAst = source->ast)
+					noErrors = contractLevelChecker.check(*sourceAst);
+			return true;
+		});
 
-		// Requires ContractLevelChecker
-		DocStringAnalyser docStringAnalyser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
+		passes.addPass("DocStringAnalyser", {"ContractLevelChecker"}, [&]() {
+			if (!forEachSource([&](SourceUnit const& _ast) { return docStringAnalyser.analyseDocStrings(_ast); }))
 				noErrors = false;
+			return true;
+		});
 
 		// Now we run full type checks that go down to the expression level. This
 		// cannot be done earlier, because we need cross-contract types and information
@@ -466,75 +512,73 @@ bool CompilerStack::analyze()
 		//
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
-		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
+		passes.addPass("TypeChecker", {"ContractLevelChecker"}, [&]() {
+			if (!forEachSource([&](SourceUnit const& _ast) { return typeChecker.checkTypeRequirements(_ast); }))
 				noErrors = false;
+			return true;
+		});
 
-		if (noErrors)
-		{
-			// Checks that can only be done when all types of all AST nodes are known.
-			PostTypeChecker postTypeChecker(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !postTypeChecker.check(*source->ast))
-					noErrors = false;
+		// Checks that can only be done when all types of all AST nodes are known.
+		passes.addPass("PostTypeChecker", {"TypeChecker"}, [&]() {
+			if (!forEachSource([&](SourceUnit const& _ast) { return postTypeChecker.check(_ast); }))
+				noErrors = false;
 			if (!postTypeChecker.finalize())
 				noErrors = false;
-		}
+			return true;
+		}, noErrorsSoFar);
 
 		// Create & assign callgraphs and check for contract dependency cycles
-		if (noErrors)
-		{
+		passes.addPass("CallGraphs", {"TypeChecker"}, [&]() {
 			createAndAssignCallGraphs();
 			findAndReportCyclicContractDependencies();
-		}
+			return true;
+		}, noErrorsSoFar);
 
-		if (noErrors)
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !PostTypeContractLevelChecker{m_errorReporter}.check(*source->ast))
-					noErrors = false;
+		passes.addPass("PostTypeContractLevelChecker", {"TypeChecker"}, [&]() {
+			if (!forEachSource([&](SourceUnit const& _ast) { return PostTypeContractLevelChecker{m_errorReporter}.check(_ast); }))
+				noErrors = false;
+			return true;
+		}, noErrorsSoFar);
 
 		// Check that immutable variables are never read in c'tors and assigned
 		// exactly once
-		if (noErrors)
+		passes.addPass("ImmutableValidator", {"TypeChecker"}, [&]() {
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
 					for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 						if (ContractDefinition* contract = dynamic_cast<ContractDefinition*>(node.get()))
 							ImmutableValidator(m_errorReporter, *contract).analyze();
+			return true;
+		}, noErrorsSoFar);
 
-		if (noErrors)
-		{
-			// Control flow graph generator and analyzer. It can check for issues such as
-			// variable is used before it is assigned to.
-			CFG cfg(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !cfg.constructFlow(*source->ast))
-					noErrors = false;
+		// Control flow graph generator and analyzer. It can check for issues such as
+		// variable is used before it is assigned to.
+		passes.addPass("ControlFlowGraph", {"TypeChecker"}, [&]() {
+			if (!forEachSource([&](SourceUnit const& _ast) { return cfg.constructFlow(_ast); }))
+				noErrors = false;
+			return true;
+		}, noErrorsSoFar);
 
-			if (noErrors)
-			{
-				ControlFlowRevertPruner pruner(cfg);
-				pruner.run();
+		passes.addPass("ControlFlowAnalyzer", {"ControlFlowGraph"}, [&]() {
+			ControlFlowRevertPruner pruner(cfg);
+			pruner.run();
 
-				ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter);
-				if (!controlFlowAnalyzer.run())
-					noErrors = false;
-			}
-		}
+			ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter);
+			if (!controlFlowAnalyzer.run())
+				noErrors = false;
+			return true;
+		}, noErrorsSoFar);
 
-		if (noErrors)
-		{
-			// Checks for common mistakes. Only generates warnings.
+		// Checks for common mistakes. Only generates warnings.
+		passes.addPass("StaticAnalyzer", {"TypeChecker"}, [&]() {
 			StaticAnalyzer staticAnalyzer(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !staticAnalyzer.analyze(*source->ast))
-					noErrors = false;
-		}
+			if (!forEachSource([&](SourceUnit const& _ast) { return staticAnalyzer.analyze(_ast); }))
+				noErrors = false;
+			return true;
+		}, noErrorsSoFar);
 
-		if (noErrors)
-		{
-			// Check for state mutability in every function.
+		// Check for state mutability in every function.
+		passes.addPass("ViewPureChecker", {"TypeChecker"}, [&]() {
 			vector<ASTPointer<ASTNode>> ast;
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
@@ -542,10 +586,10 @@ bool CompilerStack::analyze()
 
 			if (!ViewPureChecker(ast, m_errorReporter).check())
 				noErrors = false;
-		}
+			return true;
+		}, noErrorsSoFar);
 
-		if (noErrors)
-		{
+		passes.addPass("ModelChecker", {"TypeChecker"}, [&]() {
 			ModelChecker modelChecker(m_errorReporter, *this, m_smtlib2Responses, m_modelCheckerSettings, m_readFile);
 			auto allSources = applyMap(m_sourceOrder, [](Source const* _source) { return _source->ast; });
 			modelChecker.enableAllEnginesIfPragmaPresent(allSources);
@@ -554,7 +598,11 @@ bool CompilerStack::analyze()
 				if (source->ast)
 					modelChecker.analyze(*source->ast);
 			m_unhandledSMTLib2Queries += modelChecker.unhandledQueries();
-		}
+			return true;
+		}, noErrorsSoFar);
+
+		if (!passes.run())
+			return false;
 	}
 	catch (FatalError const&)
 	{
@@ -620,6 +668,19 @@ bool CompilerStack::compile(State _stopAfter)
 	if (m_hasError)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
 
+	// Utility functions are generated only once and contracts are optimized only once,
+	// even if they are created by several other contracts.
+	if (!m_sharedYulFunctions)
+		m_sharedYulFunctions = make_shared<MultiUseYulFunctionCollector::SharedFunctions>();
+	if (!m_inlineAssemblyCache)
+		m_inlineAssemblyCache = make_shared<InlineAssemblyCache>();
+	if (!m_constantOptimisationCache)
+		m_constantOptimisationCache = make_shared<evmasm::ConstantOptimisationCache>();
+	if (!m_irSubObjectCache)
+		m_irSubObjectCache = make_shared<yul::OptimizedSubObjectCache>();
+	if (!m_backendSubObjectCache)
+		m_backendSubObjectCache = make_shared<yul::OptimizedSubObjectCache>();
+
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
 
@@ -837,7 +898,13 @@ string const& CompilerStack::yulIROptimized(string const& _contractName) const
 	if (m_stackState != CompilationSuccessful)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
-	return contract(_contractName).yulIROptimized;
+	Contract const& c = contract(_contractName);
+	return c.yulIROptimized.init([&]{
+		if (!c.yulIROptimizedObject)
+			return string{};
+		yul::Dialect const& dialect = yul::EVMDialect::strictAssemblyForEVMObjects(m_evmVersion);
+		return IRGenerator::warningMessage() + c.yulIROptimizedObject->toString(&dialect) + "\n";
+	});
 }
 
 string const& CompilerStack::ewasm(string const& _contractName) const
@@ -1281,7 +1348,14 @@ void CompilerStack::compileContract(
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(
+		m_evmVersion,
+		m_revertStrings,
+		m_optimiserSettings,
+		m_sharedYulFunctions,
+		m_inlineAssemblyCache,
+		m_constantOptimisationCache
+	);
 	compiledContract.compiler = compiler;
 
 	bytes cborEncodedMetadata = createCBORMetadata(compiledContract);
@@ -1330,11 +1404,12 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	for (auto const& pair: m_contracts)
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
 
-	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings, sourceIndices());
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(
+	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings, sourceIndices(), m_sharedYulFunctions);
+	tie(compiledContract.yulIR, compiledContract.yulIROptimizedObject) = generator.run(
 		_contract,
 		createCBORMetadata(compiledContract),
-		otherYulSources
+		otherYulSources,
+		m_irSubObjectCache
 	);
 }
 
@@ -1348,13 +1423,16 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(!compiledContract.yulIROptimized.empty(), "");
+	solAssert(compiledContract.yulIROptimizedObject, "");
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
+	// Use the optimized Yul IR object directly instead of re-parsing its printed form.
 	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
+	stack.setOptimizedSubObjectCache(m_backendSubObjectCache);
+	stack.setConstantOptimisationCache(m_constantOptimisationCache);
+	bool analysisSuccessful = stack.importAndAnalyze(*compiledContract.yulIROptimizedObject, sourceIndices());
+	solAssert(analysisSuccessful, "Optimized Yul IR object failed analysis.");
 	stack.optimize();
 
 	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
@@ -1375,13 +1453,15 @@ void CompilerStack::generateEwasm(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(!compiledContract.yulIROptimized.empty(), "");
+	solAssert(compiledContract.yulIROptimizedObject, "");
 	if (!compiledContract.ewasm.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
+	// Use the optimized Yul IR object directly instead of re-parsing its printed form.
 	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
+	stack.setOptimizedSubObjectCache(m_backendSubObjectCache);
+	bool analysisSuccessful = stack.importAndAnalyze(*compiledContract.yulIROptimizedObject, sourceIndices());
+	solAssert(analysisSuccessful, "Optimized Yul IR object failed analysis.");
 
 	stack.optimize();
 	stack.translate(yul::AssemblyStack::Language::Ewasm);
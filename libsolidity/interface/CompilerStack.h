@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <libsolidity/analysis/AnalysisPassManager.h>
 #include <libsolidity/analysis/FunctionCallGraph.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/ImportRemapper.h>
 #include <libsolidity/interface/OptimiserSettings.h>
@@ -67,6 +69,13 @@ namespace solidity::evmasm
 class Assembly;
 class AssemblyItem;
 using AssemblyItems = std::vector<AssemblyItem>;
+class ConstantOptimisationCache;
+}
+
+namespace solidity::yul
+{
+struct Object;
+struct OptimizedSubObjectCache;
 }
 
 namespace solidity::frontend
@@ -78,6 +87,7 @@ class ContractDefinition;
 class FunctionDefinition;
 class SourceUnit;
 class Compiler;
+struct InlineAssemblyCache;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
@@ -217,7 +227,7 @@ public:
 
 	/// Imports given SourceUnits so they can be analyzed. Leads to the same internal state as parse().
 	/// Will throw errors if the import fails
-	void importASTs(std::map<std::string, Json::Value> const& _sources);
+	void importASTs(std::map<std::string, Json::Value> _sources);
 
 	/// Performs the analysis steps (imports, scopesetting, syntaxCheck, referenceResolving,
 	///  typechecking, staticAnalysis) on previously parsed sources.
@@ -253,6 +263,9 @@ public:
 	/// by calling @a addSMTLib2Response).
 	std::vector<std::string> const& unhandledSMTLib2Queries() const { return m_unhandledSMTLib2Queries; }
 
+	/// @returns the time spent in each analysis pass during the last call to @a analyze.
+	std::vector<AnalysisPassManager::Timing> const& analysisTimings() const { return m_analysisTimings; }
+
 	/// @returns a list of the contract names in the sources.
 	std::vector<std::string> contractNames() const;
 
@@ -365,7 +378,8 @@ private:
 		evmasm::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Experimental Yul IR code.
-		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		std::shared_ptr<yul::Object const> yulIROptimizedObject; ///< Optimized experimental Yul IR object.
+		util::LazyInit<std::string const> yulIROptimized; ///< Optimized experimental Yul IR code, printed on demand.
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
@@ -490,8 +504,19 @@ private:
 	std::vector<std::string> m_unhandledSMTLib2Queries;
 	std::map<util::h256, std::string> m_smtlib2Responses;
 	std::shared_ptr<GlobalContext> m_globalContext;
+	std::vector<AnalysisPassManager::Timing> m_analysisTimings;
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
+	/// Yul utility functions shared by the code generators of all contracts.
+	std::shared_ptr<MultiUseYulFunctionCollector::SharedFunctions> m_sharedYulFunctions;
+	/// Inline assembly blocks processed by the legacy code generator, shared by all contracts.
+	std::shared_ptr<InlineAssemblyCache> m_inlineAssemblyCache;
+	/// Representations chosen by the constant optimiser, shared by all contracts.
+	std::shared_ptr<evmasm::ConstantOptimisationCache> m_constantOptimisationCache;
+	/// Yul sub-objects optimized during IR generation, shared by all contracts that create them.
+	std::shared_ptr<yul::OptimizedSubObjectCache> m_irSubObjectCache;
+	/// Yul sub-objects optimized by the EVM and Ewasm backends, shared by all contracts that create them.
+	std::shared_ptr<yul::OptimizedSubObjectCache> m_backendSubObjectCache;
 
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
@@ -118,7 +118,8 @@ struct OptimiserSettings
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
-			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
+			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment &&
+			reasoningBasedSimplifierMaxChecks == _other.reasoningBasedSimplifierMaxChecks;
 	}
 
 	/// Move literals to the right of commutative binary operators during code generation.
@@ -149,6 +150,9 @@ struct OptimiserSettings
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
+	/// Maximum number of SMT solver queries the ReasoningBasedSimplifier makes per function.
+	/// Conditions beyond this limit are left unchanged, which keeps the step deterministic.
+	size_t reasoningBasedSimplifierMaxChecks = 1000;
 };
 
 }
@@ -0,0 +1,132 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Map that additionally keeps track of the keys that map to a given value,
+ * so that all entries with a certain value can be removed without scanning the map.
+ */
+template<typename K, typename V>
+struct InvertibleMap
+{
+	/// values[k] == v <=> references[v].count(k)
+	std::unordered_map<K, V> values;
+	std::unordered_map<V, std::set<K>> references;
+
+	void set(K const& _key, V const& _value)
+	{
+		eraseKey(_key);
+		values[_key] = _value;
+		references[_value].insert(_key);
+	}
+
+	void eraseKey(K const& _key)
+	{
+		auto it = values.find(_key);
+		if (it == values.end())
+			return;
+		auto referencesIt = references.find(it->second);
+		referencesIt->second.erase(_key);
+		if (referencesIt->second.empty())
+			references.erase(referencesIt);
+		values.erase(it);
+	}
+
+	void eraseValue(V const& _value)
+	{
+		auto it = references.find(_value);
+		if (it == references.end())
+			return;
+		for (K const& key: it->second)
+			values.erase(key);
+		references.erase(it);
+	}
+
+	/// Removes all entries for which @a _predicate(key, value) returns true.
+	template<typename Predicate>
+	void eraseIf(Predicate&& _predicate)
+	{
+		std::vector<K> keysToErase;
+		for (auto const& [key, value]: values)
+			if (_predicate(key, value))
+				keysToErase.push_back(key);
+		for (K const& key: keysToErase)
+			eraseKey(key);
+	}
+
+	void clear()
+	{
+		values.clear();
+		references.clear();
+	}
+
+	bool empty() const { return values.empty(); }
+};
+
+/**
+ * Binary relation that keeps track of both directions, so that the elements related
+ * to a given element can be found without scanning the relation in either direction.
+ */
+template<typename T>
+struct InvertibleRelation
+{
+	/// forward[x].count(y) <=> backward[y].count(x) <=> (x, y) is in the relation
+	std::unordered_map<T, std::set<T>> forward;
+	std::unordered_map<T, std::set<T>> backward;
+
+	/// Replaces all pairs with first element @a _key by pairs (_key, v) for v in @a _values.
+	void set(T const& _key, std::set<T> _values)
+	{
+		eraseKey(_key);
+		for (T const& value: _values)
+			backward[value].insert(_key);
+		forward[_key] = std::move(_values);
+	}
+
+	/// Removes all pairs with first element @a _key.
+	void eraseKey(T const& _key)
+	{
+		auto it = forward.find(_key);
+		if (it == forward.end())
+			return;
+		for (T const& value: it->second)
+		{
+			auto backwardIt = backward.find(value);
+			backwardIt->second.erase(_key);
+			if (backwardIt->second.empty())
+				backward.erase(backwardIt);
+		}
+		forward.erase(it);
+	}
+
+	void clear()
+	{
+		forward.clear();
+		backward.clear();
+	}
+};
+
+}
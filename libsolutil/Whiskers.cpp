@@ -25,12 +25,254 @@
 #include <libsolutil/Whiskers.h>
 
 #include <libsolutil/Assertions.h>
+#include <libsolutil/CommonData.h>
 
-#include <regex>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity::util;
 
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the length of the (possibly empty) parameter name starting at @a _pos.
+size_t parameterLength(string_view _text, size_t _pos)
+{
+	size_t end = _pos;
+	while (end < _text.size() && isParameterCharacter(_text[end]))
+		++end;
+	return end - _pos;
+}
+
+/**
+ * A template split into literal text and tags. Nested parts (list bodies and branches
+ * of conditions) are parsed recursively. All strings point into the template source.
+ */
+struct ParsedTemplate
+{
+	struct Element
+	{
+		enum class Kind { Text, Tag, List, Condition };
+		Kind kind;
+		/// Literal text or the name of the parameter, including the leading '+' for
+		/// conditions on string parameters.
+		string_view text;
+		/// Body of a list or the first branch of a condition.
+		unique_ptr<ParsedTemplate> body;
+		/// Second branch of a condition.
+		unique_ptr<ParsedTemplate> elseBody;
+	};
+
+	/// The part of the template this was parsed from, used in error messages.
+	string_view source;
+	vector<Element> elements;
+};
+
+/// Parses @a _template into literal text and tags. Tags are recognized exactly where the
+/// following regular expression matches, searching from left to right:
+///   <(name)>|<#(name)>(.*?)</\2>|<\?(\+?name)>(.*?)(<!\4>(.*?))?</\4>
+/// Everything else (including malformed and unterminated tags) is literal text.
+unique_ptr<ParsedTemplate> parse(string_view _template)
+{
+	auto result = make_unique<ParsedTemplate>();
+	result->source = _template;
+
+	size_t textStart = 0;
+	auto addText = [&](size_t _end) {
+		if (_end > textStart)
+			result->elements.push_back({ParsedTemplate::Element::Kind::Text, _template.substr(textStart, _end - textStart), {}, {}});
+	};
+	auto finishElement = [&](size_t _begin, size_t _end, ParsedTemplate::Element _element) {
+		addText(_begin);
+		result->elements.emplace_back(move(_element));
+		textStart = _end;
+	};
+
+	for (size_t pos = _template.find('<'); pos != string_view::npos; pos = _template.find('<', pos))
+	{
+		size_t end = pos + 1;
+		char const kind = end < _template.size() ? _template[end] : '\0';
+		if (kind == '#' || kind == '?')
+			++end;
+		if (kind == '?' && end < _template.size() && _template[end] == '+')
+			++end;
+		size_t nameLength = parameterLength(_template, end);
+		if (nameLength == 0 || end + nameLength >= _template.size() || _template[end + nameLength] != '>')
+		{
+			++pos;
+			continue;
+		}
+		if (kind != '#' && kind != '?')
+		{
+			string_view name = _template.substr(end, nameLength);
+			finishElement(pos, end + nameLength + 1, {ParsedTemplate::Element::Kind::Tag, name, {}, {}});
+			pos = textStart;
+			continue;
+		}
+
+		string_view name = _template.substr(pos + 2, end + nameLength - pos - 2);
+		size_t bodyStart = end + nameLength + 1;
+		string const closingTag = "</" + string(name) + ">";
+		size_t closing = _template.find(closingTag, bodyStart);
+		if (closing == string_view::npos)
+		{
+			++pos;
+			continue;
+		}
+		if (kind == '#')
+			finishElement(pos, closing + closingTag.size(), {
+				ParsedTemplate::Element::Kind::List,
+				name,
+				parse(_template.substr(bodyStart, closing - bodyStart)),
+				{}
+			});
+		else
+		{
+			string const elseTag = "<!" + string(name) + ">";
+			size_t elsePos = _template.find(elseTag, bodyStart);
+			// The else tag cannot overlap with the closing tag, so it either ends before it or is irrelevant.
+			if (elsePos != string_view::npos && elsePos < closing)
+				finishElement(pos, closing + closingTag.size(), {
+					ParsedTemplate::Element::Kind::Condition,
+					name,
+					parse(_template.substr(bodyStart, elsePos - bodyStart)),
+					parse(_template.substr(elsePos + elseTag.size(), closing - elsePos - elseTag.size()))
+				});
+			else
+				finishElement(pos, closing + closingTag.size(), {
+					ParsedTemplate::Element::Kind::Condition,
+					name,
+					parse(_template.substr(bodyStart, closing - bodyStart)),
+					parse({})
+				});
+		}
+		pos = textStart;
+	}
+	addText(_template.size());
+	return result;
+}
+
+/// A template together with its parsed form.
+struct CachedTemplate
+{
+	explicit CachedTemplate(string _source): source(move(_source)), parsed(parse(source)) {}
+
+	string const source;
+	unique_ptr<ParsedTemplate const> const parsed;
+};
+
+/// @returns the parsed form of @a _template. Templates are cached by content, since most of them
+/// are string literals that are rendered over and over again during code generation.
+shared_ptr<CachedTemplate const> parsedTemplate(string const& _template)
+{
+	// Templates constructed at runtime could make the cache grow without bounds.
+	static size_t constexpr maxCacheSize = 4096;
+	static mutex cacheMutex;
+	static unordered_map<string, shared_ptr<CachedTemplate const>> cache;
+
+	lock_guard<mutex> lock(cacheMutex);
+	if (shared_ptr<CachedTemplate const> const* cached = valueOrNullptr(cache, _template))
+		return *cached;
+	if (cache.size() >= maxCacheSize)
+		cache.clear();
+	return cache[_template] = make_shared<CachedTemplate const>(_template);
+}
+
+/// Values visible while rendering (a part of) a template.
+struct RenderScope
+{
+	Whiskers::StringMap const& parameters;
+	/// Parameters of the current list element, if inside of a list.
+	Whiskers::StringMap const* listElement;
+	map<string, bool> const& conditions;
+	/// List parameters, null inside of a list.
+	Whiskers::StringListMap const* listParameters;
+
+	string const* parameter(string const& _name) const
+	{
+		if (listElement)
+			if (string const* value = valueOrNullptr(*listElement, _name))
+				return value;
+		return valueOrNullptr(parameters, _name);
+	}
+};
+
+void renderTemplate(ParsedTemplate const& _template, RenderScope const& _scope, string& _output)
+{
+	for (ParsedTemplate::Element const& element: _template.elements)
+		switch (element.kind)
+		{
+		case ParsedTemplate::Element::Kind::Text:
+			_output += element.text;
+			break;
+		case ParsedTemplate::Element::Kind::Tag:
+		{
+			string const* value = _scope.parameter(string(element.text));
+			assertThrow(
+				value,
+				WhiskersError,
+				"Value for tag " + string(element.text) + " not provided.\n" +
+				"Template:\n" +
+				string(_template.source)
+			);
+			_output += *value;
+			break;
+		}
+		case ParsedTemplate::Element::Kind::List:
+		{
+			string listName(element.text);
+			vector<Whiskers::StringMap> const* values =
+				_scope.listParameters ? valueOrNullptr(*_scope.listParameters, listName) : nullptr;
+			assertThrow(values, WhiskersError, "List parameter " + listName + " not set.");
+			for (Whiskers::StringMap const& listElement: *values)
+			{
+				for (auto const& parameter: listElement)
+					assertThrow(
+						!_scope.parameter(parameter.first),
+						WhiskersError,
+						"Parameter collision"
+					);
+				renderTemplate(*element.body, RenderScope{_scope.parameters, &listElement, _scope.conditions, nullptr}, _output);
+			}
+			break;
+		}
+		case ParsedTemplate::Element::Kind::Condition:
+		{
+			bool conditionValue = false;
+			if (element.text[0] == '+')
+			{
+				string tag(element.text.substr(1));
+				string const* value = _scope.parameter(tag);
+				assertThrow(value, WhiskersError, "Tag " + tag + " used as condition but was not set.");
+				conditionValue = !value->empty();
+			}
+			else
+			{
+				string conditionName(element.text);
+				bool const* value = valueOrNullptr(_scope.conditions, conditionName);
+				assertThrow(value, WhiskersError, "Condition parameter " + conditionName + " not set.");
+				conditionValue = *value;
+			}
+			renderTemplate(conditionValue ? *element.body : *element.elseBody, _scope, _output);
+			break;
+		}
+		}
+}
+
+}
+
 Whiskers::Whiskers(string _template):
 	m_template(move(_template))
 {
@@ -71,14 +313,17 @@ Whiskers& Whiskers::operator()(
 
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	shared_ptr<CachedTemplate const> cachedTemplate = parsedTemplate(m_template);
+	string result;
+	result.reserve(m_template.size());
+	renderTemplate(*cachedTemplate->parsed, RenderScope{m_parameters, nullptr, m_conditions, &m_listParameters}, result);
+	return result;
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && parameterLength(_parameter, 0) == _parameter.size(),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -115,116 +360,3 @@ void Whiskers::checkTemplateContainsTags(string const& _parameter, vector<string
 		);
 	}
 }
-
-namespace
-{
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
-{
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
-	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
-	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
-}
-}
-
-string Whiskers::replace(
-	string const& _template,
-	StringMap const& _parameters,
-	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
-)
-{
-	static regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
-		{
-			assertThrow(
-				_parameters.count(tagName),
-				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
-				"Template:\n" +
-				_template
-			);
-			return _parameters.at(tagName);
-		}
-		else if (!listName.empty())
-		{
-			string templ(_match[3]);
-			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
-			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
-		}
-		else
-		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
-			bool conditionValue = false;
-			if (conditionName[0] == '+')
-			{
-				string tag = conditionName.substr(1);
-				assertThrow(
-					_parameters.count(tag),
-					WhiskersError, "Tag " + tag + " used as condition but was not set."
-				);
-				conditionValue = !_parameters.at(tag).empty();
-			}
-			else
-			{
-				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
-				);
-				conditionValue = _conditions.at(conditionName);
-			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
-		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
-}
-
@@ -34,9 +34,11 @@
 #include <libyul/backends/wasm/WasmObjectCompiler.h>
 #include <libyul/backends/wasm/EVMToEwasmTranslator.h>
 #include <libyul/ObjectParser.h>
+#include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/Suite.h>
 
 #include <libevmasm/Assembly.h>
+#include <libsolutil/CommonData.h>
 #include <liblangutil/Scanner.h>
 #include <optional>
 
@@ -71,7 +73,7 @@ evmasm::Assembly::OptimiserSettings translateOptimiserSettings(
 )
 {
 	// Constructing it this way so that we notice changes in the fields.
-	evmasm::Assembly::OptimiserSettings asmSettings{false, false,  false, false, false, false, false, _evmVersion, 0};
+	evmasm::Assembly::OptimiserSettings asmSettings{false, false,  false, false, false, false, false, _evmVersion, 0, nullptr};
 	asmSettings.isCreation = true;
 	asmSettings.runInliner = _settings.runInliner;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
@@ -85,6 +87,23 @@ evmasm::Assembly::OptimiserSettings translateOptimiserSettings(
 	return asmSettings;
 }
 
+/// @returns a deep copy of the code of @a _object and its sub-objects.
+/// Data objects are never modified and are thus shared with the original.
+shared_ptr<Object> copyObject(Object const& _object)
+{
+	auto copy = make_shared<Object>();
+	copy->name = _object.name;
+	copy->subId = _object.subId;
+	copy->code = make_shared<Block>(ASTCopier{}.translate(*_object.code));
+	copy->subIndexByName = _object.subIndexByName;
+	for (shared_ptr<ObjectNode> const& subNode: _object.subObjects)
+		if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+			copy->subObjects.emplace_back(copyObject(*subObject));
+		else
+			copy->subObjects.emplace_back(subNode);
+	return copy;
+}
+
 }
 
 
@@ -100,6 +119,7 @@ bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string
 	m_errors.clear();
 	m_analysisSuccessful = false;
 	m_charStream = make_unique<CharStream>(_source, _sourceName);
+	m_sourceIndices = {{_sourceName, 0}};
 	shared_ptr<Scanner> scanner = make_shared<Scanner>(*m_charStream);
 	m_parserResult = ObjectParser(m_errorReporter, languageToDialect(m_language, m_evmVersion)).parse(scanner, false);
 	if (!m_errorReporter.errors().empty())
@@ -110,6 +130,19 @@ bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string
 	return analyzeParsed();
 }
 
+bool AssemblyStack::importAndAnalyze(Object const& _object, map<string, unsigned> _sourceIndices)
+{
+	yulAssert(_object.code, "");
+
+	m_errors.clear();
+	m_analysisSuccessful = false;
+	m_charStream.reset();
+	m_sourceIndices = move(_sourceIndices);
+	m_parserResult = copyObject(_object);
+
+	return analyzeParsed();
+}
+
 void AssemblyStack::optimize()
 {
 	if (!m_optimiserSettings.runYulOptimiser)
@@ -194,7 +227,26 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 	yulAssert(_object.analysisInfo, "");
 	for (auto& subNode: _object.subObjects)
 		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
-			optimize(*subObject, false);
+		{
+			if (!m_optimizedSubObjects || subObject->name.empty())
+			{
+				optimize(*subObject, false);
+				continue;
+			}
+
+			pair<Language, YulString> key{m_language, subObject->name};
+			if (shared_ptr<Object const> const* cached = util::valueOrNullptr(m_optimizedSubObjects->objects, key))
+			{
+				shared_ptr<Object> copy = copyObject(**cached);
+				yulAssert(analyzeParsed(*copy), "Invalid cached sub-object.");
+				subNode = move(copy);
+			}
+			else
+			{
+				optimize(*subObject, false);
+				m_optimizedSubObjects->objects[key] = copyObject(*subObject);
+			}
+		}
 
 	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
 	unique_ptr<GasMeter> meter;
@@ -207,7 +259,8 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 		m_optimiserSettings.optimizeStackAllocation,
 		m_optimiserSettings.yulOptimiserSteps,
 		_isCreation ? nullopt : make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+		{},
+		m_optimiserSettings.reasoningBasedSimplifierMaxChecks
 	);
 }
 
@@ -244,7 +297,6 @@ AssemblyStack::assembleWithDeployed(optional<string_view> _deployName) const
 {
 	auto [creationAssembly, deployedAssembly] = assembleEVMWithDeployed(_deployName);
 	yulAssert(creationAssembly, "");
-	yulAssert(m_charStream, "");
 
 	MachineAssemblyObject creationObject;
 	creationObject.bytecode = make_shared<evmasm::LinkerObject>(creationAssembly->assemble());
@@ -253,7 +305,7 @@ AssemblyStack::assembleWithDeployed(optional<string_view> _deployName) const
 	creationObject.sourceMappings = make_unique<string>(
 		evmasm::AssemblyItem::computeSourceMapping(
 			creationAssembly->items(),
-			{{m_charStream->name(), 0}}
+			m_sourceIndices
 		)
 	);
 
@@ -265,7 +317,7 @@ AssemblyStack::assembleWithDeployed(optional<string_view> _deployName) const
 		deployedObject.sourceMappings = make_unique<string>(
 			evmasm::AssemblyItem::computeSourceMapping(
 				deployedAssembly->items(),
-				{{m_charStream->name(), 0}}
+				m_sourceIndices
 			)
 		);
 	}
@@ -285,7 +337,9 @@ AssemblyStack::assembleEVMWithDeployed(optional<string_view> _deployName) const
 	EthAssemblyAdapter adapter(assembly);
 	compileEVM(adapter, m_optimiserSettings.optimizeStackAllocation);
 
-	assembly.optimise(translateOptimiserSettings(m_optimiserSettings, m_evmVersion));
+	evmasm::Assembly::OptimiserSettings asmSettings = translateOptimiserSettings(m_optimiserSettings, m_evmVersion);
+	asmSettings.constantOptimisationCache = m_constantOptimisationCache;
+	assembly.optimise(asmSettings);
 
 	optional<size_t> subIndex;
 
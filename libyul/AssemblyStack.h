@@ -33,12 +33,15 @@
 
 #include <libevmasm/LinkerObject.h>
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace solidity::evmasm
 {
 class Assembly;
+class ConstantOptimisationCache;
 }
 
 namespace solidity::langutil
@@ -49,6 +52,7 @@ class Scanner;
 namespace solidity::yul
 {
 class AbstractAssembly;
+struct OptimizedSubObjectCache;
 
 
 struct MachineAssemblyObject
@@ -85,10 +89,33 @@ public:
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
 
+	/// Runs the analysis step on a copy of the already parsed object @a _object instead of
+	/// parsing source code, returns false if it cannot be assembled.
+	/// Since there is no source, errors cannot refer to the char stream.
+	/// @a _sourceIndices maps the source names used in the debug data of @a _object to
+	/// the indices used in the source mappings produced by @a assemble.
+	/// Multiple calls overwrite the previous state.
+	bool importAndAnalyze(Object const& _object, std::map<std::string, unsigned> _sourceIndices = {});
+
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
 	void optimize();
 
+	/// Makes the optimizer take sub-objects from @a _cache instead of optimizing them again
+	/// and store the sub-objects it does optimize there.
+	/// The cache can be shared between assembly stacks with the same settings, as long as
+	/// sub-objects with the same name are identical before optimization.
+	void setOptimizedSubObjectCache(std::shared_ptr<OptimizedSubObjectCache> _cache)
+	{
+		m_optimizedSubObjects = std::move(_cache);
+	}
+
+	/// Makes the constant optimiser of @a assemble reuse the representations stored in @a _cache.
+	void setConstantOptimisationCache(std::shared_ptr<evmasm::ConstantOptimisationCache> _cache)
+	{
+		m_constantOptimisationCache = std::move(_cache);
+	}
+
 	/// Translate the source to a different language / dialect.
 	void translate(Language _targetLanguage);
 
@@ -134,6 +161,8 @@ private:
 	solidity::frontend::OptimiserSettings m_optimiserSettings;
 
 	std::unique_ptr<langutil::CharStream> m_charStream;
+	/// Source indices used for the source mappings, see @a importAndAnalyze.
+	std::map<std::string, unsigned> m_sourceIndices;
 
 	bool m_analysisSuccessful = false;
 	std::shared_ptr<yul::Object> m_parserResult;
@@ -141,6 +170,17 @@ private:
 	langutil::ErrorReporter m_errorReporter;
 
 	std::unique_ptr<std::string> m_sourceMappings;
+	std::shared_ptr<OptimizedSubObjectCache> m_optimizedSubObjects;
+	std::shared_ptr<evmasm::ConstantOptimisationCache> m_constantOptimisationCache;
+};
+
+/**
+ * Sub-objects that have already been optimized (as non-creation objects),
+ * keyed by the language they were optimized in and their name.
+ */
+struct OptimizedSubObjectCache
+{
+	std::map<std::pair<AssemblyStack::Language, YulString>, std::shared_ptr<Object const>> objects;
 };
 
 }
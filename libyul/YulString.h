@@ -148,6 +148,9 @@ public:
 	bool operator!=(YulString const& _other) const { return m_handle.id != _other.m_handle.id; }
 
 	bool empty() const { return m_handle.id == 0; }
+	/// @returns the ID of the string in the repository. IDs are small and dense,
+	/// but only valid until the repository is reset.
+	size_t id() const { return m_handle.id; }
 	std::string const& str() const
 	{
 		return YulStringRepository::instance().idToString(m_handle.id);
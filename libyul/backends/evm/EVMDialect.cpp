@@ -36,6 +36,8 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/tail.hpp>
 
+#include <boost/algorithm/string/predicate.hpp>
+
 #include <regex>
 
 using namespace std;
@@ -64,7 +66,7 @@ pair<YulString, BuiltinFunctionForEVM> createEVMFunction(
 	evmasm::Instruction _instruction
 )
 {
-	evmasm::InstructionInfo info = evmasm::instructionInfo(_instruction);
+	evmasm::InstructionMetadata const& info = evmasm::instructionMetadata(_instruction);
 	BuiltinFunctionForEVM f;
 	f.name = YulString{_name};
 	f.parameters.resize(static_cast<size_t>(info.args));
@@ -115,9 +117,9 @@ pair<YulString, BuiltinFunctionForEVM> createFunction(
 set<YulString> createReservedIdentifiers()
 {
 	set<YulString> reserved;
-	for (auto const& instr: evmasm::c_instructions)
+	for (auto const& instr: evmasm::c_validInstructions)
 	{
-		string name = instr.first;
+		string name{instr.second.name};
 		transform(name.begin(), name.end(), name.begin(), [](unsigned char _c) { return tolower(_c); });
 		reserved.emplace(name);
 	}
@@ -135,11 +137,11 @@ set<YulString> createReservedIdentifiers()
 map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVersion, bool _objectAccess)
 {
 	map<YulString, BuiltinFunctionForEVM> builtins;
-	for (auto const& instr: evmasm::c_instructions)
+	for (auto const& instr: evmasm::c_validInstructions)
 	{
-		string name = instr.first;
+		string name{instr.second.name};
 		transform(name.begin(), name.end(), name.begin(), [](unsigned char _c) { return tolower(_c); });
-		auto const opcode = instr.second;
+		auto const opcode = instr.first;
 
 		if (
 			!evmasm::isDupInstruction(opcode) &&
@@ -302,21 +304,21 @@ EVMDialect::EVMDialect(langutil::EVMVersion _evmVersion, bool _objectAccess):
 	m_functions(createBuiltins(_evmVersion, _objectAccess)),
 	m_reserved(createReservedIdentifiers())
 {
+	createBuiltinLookupTable();
 }
 
 BuiltinFunctionForEVM const* EVMDialect::builtin(YulString _name) const
 {
-	if (m_objectAccess)
+	if (_name.id() < m_functionsByID.size())
+		if (BuiltinFunctionForEVM const* function = m_functionsByID[_name.id()])
+			return function;
+	if (m_objectAccess && boost::starts_with(_name.str(), "verbatim"))
 	{
 		smatch match;
 		if (regex_match(_name.str(), match, verbatimPattern()))
 			return verbatimFunction(stoul(match[1]), stoul(match[2]));
 	}
-	auto it = m_functions.find(_name);
-	if (it != m_functions.end())
-		return &it->second;
-	else
-		return nullptr;
+	return nullptr;
 }
 
 bool EVMDialect::reservedIdentifier(YulString _name) const
@@ -364,6 +366,17 @@ SideEffects EVMDialect::sideEffectsOfInstruction(evmasm::Instruction _instructio
 	};
 }
 
+void EVMDialect::createBuiltinLookupTable()
+{
+	m_functionsByID.clear();
+	for (auto const& [name, function]: m_functions)
+	{
+		if (m_functionsByID.size() <= name.id())
+			m_functionsByID.resize(name.id() + 1, nullptr);
+		m_functionsByID[name.id()] = &function;
+	}
+}
+
 BuiltinFunctionForEVM const* EVMDialect::verbatimFunction(size_t _arguments, size_t _returnVariables) const
 {
 	pair<size_t, size_t> key{_arguments, _returnVariables};
@@ -476,6 +489,8 @@ EVMDialectTyped::EVMDialectTyped(langutil::EVMVersion _evmVersion, bool _objectA
 	}));
 	m_functions["u256_to_bool"_yulstring].parameters = {"u256"_yulstring};
 	m_functions["u256_to_bool"_yulstring].returns = {"bool"_yulstring};
+
+	createBuiltinLookupTable();
 }
 
 BuiltinFunctionForEVM const* EVMDialectTyped::discardFunction(YulString _type) const
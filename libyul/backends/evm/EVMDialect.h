@@ -29,6 +29,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -94,10 +95,14 @@ struct EVMDialect: public Dialect
 
 protected:
 	BuiltinFunctionForEVM const* verbatimFunction(size_t _arguments, size_t _returnVariables) const;
+	/// Fills m_functionsByID from m_functions. Has to be called whenever m_functions changes.
+	void createBuiltinLookupTable();
 
 	bool const m_objectAccess;
 	langutil::EVMVersion const m_evmVersion;
 	std::map<YulString, BuiltinFunctionForEVM> m_functions;
+	/// Builtins from m_functions indexed by the ID of their name, nullptr for other IDs.
+	std::vector<BuiltinFunctionForEVM const*> m_functionsByID;
 	std::map<std::pair<size_t, size_t>, std::shared_ptr<BuiltinFunctionForEVM const>> mutable m_verbatimFunctions;
 	std::set<YulString> m_reserved;
 };
@@ -36,7 +36,7 @@ using namespace solidity::langutil;
 
 void NoOutputAssembly::appendInstruction(evmasm::Instruction _instr)
 {
-	m_stackHeight += instructionInfo(_instr).ret - instructionInfo(_instr).args;
+	m_stackHeight += instructionMetadata(_instr).ret - instructionMetadata(_instr).args;
 }
 
 void NoOutputAssembly::appendConstant(u256 const&)
@@ -0,0 +1,55 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the analyses of the full AST that depend only on the call graph.
+ */
+
+#include <libyul/optimiser/CallGraphAnalysisCache.h>
+
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/AST.h>
+#include <libyul/Dialect.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+CallGraphAnalysisCache::Analysis const& CallGraphAnalysisCache::analyze(Dialect const& _dialect, Block const& _ast)
+{
+	if (m_analysis && m_dialect == &_dialect)
+	{
+		++m_statistics.reused;
+		return *m_analysis;
+	}
+
+	++m_statistics.recomputed;
+	m_dialect = &_dialect;
+	m_analysis = Analysis{};
+	CallGraph callGraph = CallGraphGenerator::callGraph(_ast);
+	m_analysis->recursiveFunctions = callGraph.recursiveFunctions();
+	m_analysis->functionSideEffects = SideEffectsPropagator::sideEffects(_dialect, callGraph);
+	// The call graph contains every function call in the AST, so this is equivalent
+	// to MSizeFinder::containsMSize.
+	for (auto const& [function, callees]: callGraph.functionCalls)
+		for (YulString callee: callees)
+			if (BuiltinFunction const* builtin = _dialect.builtin(callee))
+				if (builtin->isMSize)
+					m_analysis->containsMSize = true;
+	m_analysis->callGraph = std::move(callGraph);
+	return *m_analysis;
+}
@@ -0,0 +1,81 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the analyses of the full AST that depend only on the call graph.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulString.h>
+
+#include <map>
+#include <optional>
+#include <set>
+
+namespace solidity::yul
+{
+struct Dialect;
+struct Block;
+
+/**
+ * Cache for the side-effects of user-defined functions, the set of recursive functions
+ * and whether msize is used. Many optimiser steps need these for the full AST.
+ *
+ * All of them depend only on the call graph. Computing them needs a walk over the AST and
+ * is quadratic in the number of functions in the worst case. They are re-used until
+ * @a invalidate is called. Optimiser steps that might change the set of functions called
+ * by any function (including builtins) or the set of functions containing loops have to
+ * call @a invalidate after they modified the AST. Steps that only rename variables, split,
+ * join or move expressions inside a function, or restructure blocks do not.
+ */
+class CallGraphAnalysisCache
+{
+public:
+	struct Analysis
+	{
+		CallGraph callGraph;
+		std::set<YulString> recursiveFunctions;
+		std::map<YulString, SideEffects> functionSideEffects;
+		/// True if the code contains msize or a builtin that could contain msize.
+		bool containsMSize = false;
+	};
+
+	/// @returns the analysis of @a _ast, which has to be a full AST.
+	/// The reference stays valid until the next call to @a analyze or @a invalidate.
+	Analysis const& analyze(Dialect const& _dialect, Block const& _ast);
+	/// Discards the analysis. Has to be called whenever the call graph of the AST might
+	/// have changed.
+	void invalidate() { m_analysis.reset(); }
+
+	struct Statistics
+	{
+		/// Requests answered without walking the AST.
+		size_t reused = 0;
+		size_t recomputed = 0;
+	};
+	Statistics const& statistics() const { return m_statistics; }
+
+private:
+	Dialect const* m_dialect = nullptr;
+	std::optional<Analysis> m_analysis;
+	Statistics m_statistics;
+};
+
+}
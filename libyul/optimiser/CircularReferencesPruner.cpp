@@ -29,6 +29,7 @@ using namespace solidity::yul;
 void CircularReferencesPruner::run(OptimiserStepContext& _context, Block& _ast)
 {
 	CircularReferencesPruner{_context.reservedIdentifiers}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void CircularReferencesPruner::operator()(Block& _block)
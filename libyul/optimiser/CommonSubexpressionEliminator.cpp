@@ -39,7 +39,7 @@ void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _
 {
 	CommonSubexpressionEliminator cse{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		_context.callGraphAnalysis.analyze(_context.dialect, _ast).functionSideEffects
 	};
 	cse(_ast);
 }
@@ -81,6 +81,7 @@ void ControlFlowSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
 	TypeInfo typeInfo(_context.dialect, _ast);
 	ControlFlowSimplifier{_context.dialect, typeInfo}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void ControlFlowSimplifier::operator()(Block& _block)
@@ -64,20 +64,22 @@ void DataFlowAnalyzer::operator()(ExpressionStatement& _statement)
 	if (auto vars = isSimpleStore(StoreLoadLocation::Storage, _statement))
 	{
 		ASTModifier::operator()(_statement);
-		cxx20::erase_if(m_storage, mapTuple([&](auto&& key, auto&& value) {
+		KnowledgeMap& storage = modifiable(m_storage);
+		storage.eraseIf([&](YulString _key, YulString _value) {
 			return
-				!m_knowledgeBase.knownToBeDifferent(vars->first, key) &&
-				!m_knowledgeBase.knownToBeEqual(vars->second, value);
-		}));
-		m_storage[vars->first] = vars->second;
+				!m_knowledgeBase.knownToBeDifferent(vars->first, _key) &&
+				!m_knowledgeBase.knownToBeEqual(vars->second, _value);
+		});
+		storage.set(vars->first, vars->second);
 	}
 	else if (auto vars = isSimpleStore(StoreLoadLocation::Memory, _statement))
 	{
 		ASTModifier::operator()(_statement);
-		cxx20::erase_if(m_memory, mapTuple([&](auto&& key, auto&& /* value */) {
-			return !m_knowledgeBase.knownToBeDifferentByAtLeast32(vars->first, key);
-		}));
-		m_memory[vars->first] = vars->second;
+		KnowledgeMap& memory = modifiable(m_memory);
+		memory.eraseIf([&](YulString _key, YulString /* _value */) {
+			return !m_knowledgeBase.knownToBeDifferentByAtLeast32(vars->first, _key);
+		});
+		memory.set(vars->first, vars->second);
 	}
 	else
 	{
@@ -116,8 +118,9 @@ void DataFlowAnalyzer::operator()(VariableDeclaration& _varDecl)
 void DataFlowAnalyzer::operator()(If& _if)
 {
 	clearKnowledgeIfInvalidated(*_if.condition);
-	unordered_map<YulString, YulString> storage = m_storage;
-	unordered_map<YulString, YulString> memory = m_memory;
+	// Only takes references, the maps are copied when they are modified.
+	shared_ptr<KnowledgeMap const> storage = m_storage;
+	shared_ptr<KnowledgeMap const> memory = m_memory;
 
 	ASTModifier::operator()(_if);
 
@@ -135,8 +138,8 @@ void DataFlowAnalyzer::operator()(Switch& _switch)
 	set<YulString> assignedVariables;
 	for (auto& _case: _switch.cases)
 	{
-		unordered_map<YulString, YulString> storage = m_storage;
-		unordered_map<YulString, YulString> memory = m_memory;
+		shared_ptr<KnowledgeMap const> storage = m_storage;
+		shared_ptr<KnowledgeMap const> memory = m_memory;
 		(*this)(_case.body);
 		joinKnowledge(storage, memory);
 
@@ -156,11 +159,15 @@ void DataFlowAnalyzer::operator()(FunctionDefinition& _fun)
 {
 	// Save all information. We might rather reinstantiate this class,
 	// but this could be difficult if it is subclassed.
+	// The knowledge base caches information derived from m_value, so it is reset
+	// both here and after m_value has been restored (the guard is destroyed last).
+	ScopeGuard knowledgeBaseResetter([&]() { m_knowledgeBase.reset(); });
+	m_knowledgeBase.reset();
 	ScopedSaveAndRestore valueResetter(m_value, {});
 	ScopedSaveAndRestore loopDepthResetter(m_loopDepth, 0u);
 	ScopedSaveAndRestore referencesResetter(m_references, {});
-	ScopedSaveAndRestore storageResetter(m_storage, {});
-	ScopedSaveAndRestore memoryResetter(m_memory, {});
+	ScopedSaveAndRestore storageResetter(m_storage, make_shared<KnowledgeMap>());
+	ScopedSaveAndRestore memoryResetter(m_memory, make_shared<KnowledgeMap>());
 	pushScope(true);
 
 	for (auto const& parameter: _fun.parameters)
@@ -246,17 +253,12 @@ void DataFlowAnalyzer::handleAssignment(set<YulString> const& _variables, Expres
 	auto const& referencedVariables = movableChecker.referencedVariables();
 	for (auto const& name: _variables)
 	{
-		m_references[name] = referencedVariables;
+		m_references.set(name, referencedVariables);
 		if (!_isDeclaration)
 		{
-			// assignment to slot denoted by "name"
-			m_storage.erase(name);
-			// assignment to slot contents denoted by "name"
-			cxx20::erase_if(m_storage, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
-			// assignment to slot denoted by "name"
-			m_memory.erase(name);
-			// assignment to slot contents denoted by "name"
-			cxx20::erase_if(m_memory, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
+			// assignment to slot or slot contents denoted by "name"
+			eraseVariable(m_storage, name);
+			eraseVariable(m_memory, name);
 		}
 	}
 
@@ -269,9 +271,9 @@ void DataFlowAnalyzer::handleAssignment(set<YulString> const& _variables, Expres
 			// On the other hand, if we knew the value in the slot
 			// already, then the sload() / mload() would have been replaced by a variable anyway.
 			if (auto key = isSimpleLoad(StoreLoadLocation::Memory, *_value))
-				m_memory[*key] = variable;
+				modifiable(m_memory).set(*key, variable);
 			else if (auto key = isSimpleLoad(StoreLoadLocation::Storage, *_value))
-				m_storage[*key] = variable;
+				modifiable(m_storage).set(*key, variable);
 		}
 	}
 }
@@ -286,7 +288,8 @@ void DataFlowAnalyzer::popScope()
 	for (auto const& name: m_variableScopes.back().variables)
 	{
 		m_value.erase(name);
-		m_references.erase(name);
+		m_knowledgeBase.valueChanged(name);
+		m_references.eraseKey(name);
 	}
 	m_variableScopes.pop_back();
 }
@@ -309,52 +312,55 @@ void DataFlowAnalyzer::clearValues(set<YulString> _variables)
 	// First clear storage knowledge, because we do not have to clear
 	// storage knowledge of variables whose expression has changed,
 	// since the value is still unchanged.
-	auto eraseCondition = mapTuple([&_variables](auto&& key, auto&& value) {
-		return _variables.count(key) || _variables.count(value);
-	});
-	cxx20::erase_if(m_storage, eraseCondition);
-	cxx20::erase_if(m_memory, eraseCondition);
+	for (auto const& name: _variables)
+	{
+		eraseVariable(m_storage, name);
+		eraseVariable(m_memory, name);
+	}
 
 	// Also clear variables that reference variables to be cleared.
+	// Variables added here are visited by the loop as well if they come
+	// later in the order of the set.
 	for (auto const& variableToClear: _variables)
-		for (auto const& [ref, names]: m_references)
-			if (names.count(variableToClear))
-				_variables.emplace(ref);
+		if (auto const* referencingVariables = valueOrNullptr(m_references.backward, variableToClear))
+			_variables += *referencingVariables;
 
 	// Clear the value and update the reference relation.
 	for (auto const& name: _variables)
 	{
 		m_value.erase(name);
-		m_references.erase(name);
+		m_knowledgeBase.valueChanged(name);
+		m_references.eraseKey(name);
 	}
 }
 
 void DataFlowAnalyzer::assignValue(YulString _variable, Expression const* _value)
 {
 	m_value[_variable] = {_value, m_loopDepth};
+	m_knowledgeBase.valueChanged(_variable);
 }
 
 void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 {
 	SideEffectsCollector sideEffects(m_dialect, _block, &m_functionSideEffects);
 	if (sideEffects.invalidatesStorage())
-		m_storage.clear();
+		clearKnowledge(m_storage);
 	if (sideEffects.invalidatesMemory())
-		m_memory.clear();
+		clearKnowledge(m_memory);
 }
 
 void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 {
 	SideEffectsCollector sideEffects(m_dialect, _expr, &m_functionSideEffects);
 	if (sideEffects.invalidatesStorage())
-		m_storage.clear();
+		clearKnowledge(m_storage);
 	if (sideEffects.invalidatesMemory())
-		m_memory.clear();
+		clearKnowledge(m_memory);
 }
 
 void DataFlowAnalyzer::joinKnowledge(
-	unordered_map<YulString, YulString> const& _olderStorage,
-	unordered_map<YulString, YulString> const& _olderMemory
+	shared_ptr<KnowledgeMap const> const& _olderStorage,
+	shared_ptr<KnowledgeMap const> const& _olderMemory
 )
 {
 	joinKnowledgeHelper(m_storage, _olderStorage);
@@ -362,18 +368,47 @@ void DataFlowAnalyzer::joinKnowledge(
 }
 
 void DataFlowAnalyzer::joinKnowledgeHelper(
-	std::unordered_map<YulString, YulString>& _this,
-	std::unordered_map<YulString, YulString> const& _older
+	shared_ptr<KnowledgeMap>& _this,
+	shared_ptr<KnowledgeMap const> const& _older
 )
 {
+	// Nothing was modified since the older point.
+	if (_this == _older)
+		return;
 	// We clear if the key does not exist in the older map or if the value is different.
 	// This also works for memory because _older is an "older version"
 	// of m_memory and thus any overlapping write would have cleared the keys
 	// that are not known to be different inside m_memory already.
-	cxx20::erase_if(_this, mapTuple([&_older](auto&& key, auto&& currentValue){
-		YulString const* oldValue = valueOrNullptr(_older, key);
-		return !oldValue || *oldValue != currentValue;
-	}));
+	modifiable(_this).eraseIf([&_older](YulString _key, YulString _currentValue){
+		YulString const* oldValue = valueOrNullptr(_older->values, _key);
+		return !oldValue || *oldValue != _currentValue;
+	});
+}
+
+DataFlowAnalyzer::KnowledgeMap& DataFlowAnalyzer::modifiable(shared_ptr<KnowledgeMap>& _knowledge)
+{
+	if (_knowledge.use_count() > 1)
+		_knowledge = make_shared<KnowledgeMap>(*_knowledge);
+	return *_knowledge;
+}
+
+void DataFlowAnalyzer::clearKnowledge(shared_ptr<KnowledgeMap>& _knowledge)
+{
+	if (_knowledge->empty())
+		return;
+	if (_knowledge.use_count() > 1)
+		_knowledge = make_shared<KnowledgeMap>();
+	else
+		_knowledge->clear();
+}
+
+void DataFlowAnalyzer::eraseVariable(shared_ptr<KnowledgeMap>& _knowledge, YulString _variable)
+{
+	if (!_knowledge->values.count(_variable) && !_knowledge->references.count(_variable))
+		return;
+	KnowledgeMap& knowledge = modifiable(_knowledge);
+	knowledge.eraseKey(_variable);
+	knowledge.eraseValue(_variable);
 }
 
 bool DataFlowAnalyzer::inScope(YulString _variableName) const
@@ -30,8 +30,10 @@
 #include <libyul/SideEffects.h>
 
 #include <libsolutil/Common.h>
+#include <libsolutil/InvertibleMap.h>
 
 #include <map>
+#include <memory>
 #include <set>
 
 namespace solidity::yul
@@ -120,19 +122,32 @@ protected:
 	/// Clears knowledge about storage or memory if they may be modified inside the expression.
 	void clearKnowledgeIfInvalidated(Expression const& _expression);
 
+	/// Knowledge about the contents of storage or memory. Snapshots taken at control-flow
+	/// splits share the map with the current state until one of them modifies it.
+	using KnowledgeMap = util::InvertibleMap<YulString, YulString>;
+
 	/// Joins knowledge about storage and memory with an older point in the control-flow.
 	/// This only works if the current state is a direct successor of the older point,
 	/// i.e. `_otherStorage` and `_otherMemory` cannot have additional changes.
 	void joinKnowledge(
-		std::unordered_map<YulString, YulString> const& _olderStorage,
-		std::unordered_map<YulString, YulString> const& _olderMemory
+		std::shared_ptr<KnowledgeMap const> const& _olderStorage,
+		std::shared_ptr<KnowledgeMap const> const& _olderMemory
 	);
 
 	static void joinKnowledgeHelper(
-		std::unordered_map<YulString, YulString>& _thisData,
-		std::unordered_map<YulString, YulString> const& _olderData
+		std::shared_ptr<KnowledgeMap>& _thisData,
+		std::shared_ptr<KnowledgeMap const> const& _olderData
 	);
 
+	/// @returns a reference to @a _knowledge that can be modified, copying the map first
+	/// if it is shared with a snapshot.
+	static KnowledgeMap& modifiable(std::shared_ptr<KnowledgeMap>& _knowledge);
+	/// Removes all entries from @a _knowledge without copying a shared map.
+	static void clearKnowledge(std::shared_ptr<KnowledgeMap>& _knowledge);
+	/// Removes all entries with key or value @a _variable from @a _knowledge.
+	/// Does not copy a shared map if there is no such entry.
+	static void eraseVariable(std::shared_ptr<KnowledgeMap>& _knowledge, YulString _variable);
+
 	/// Returns true iff the variable is in scope.
 	bool inScope(YulString _variableName) const;
 
@@ -166,11 +181,15 @@ protected:
 
 	/// Current values of variables, always movable.
 	std::map<YulString, AssignedValue> m_value;
-	/// m_references[a].contains(b) <=> the current expression assigned to a references b
-	std::unordered_map<YulString, std::set<YulString>> m_references;
-
-	std::unordered_map<YulString, YulString> m_storage;
-	std::unordered_map<YulString, YulString> m_memory;
+	/// m_references.forward[a].contains(b) <=> the current expression assigned to a references b
+	/// The inverse direction is used to find the variables to clear when b changes.
+	util::InvertibleRelation<YulString> m_references;
+
+	/// Known contents of storage and memory. The inverse direction is used to clear
+	/// the knowledge about all slots containing a variable when it is re-assigned.
+	/// Never null. Use modifiable() before changing them.
+	std::shared_ptr<KnowledgeMap> m_storage = std::make_shared<KnowledgeMap>();
+	std::shared_ptr<KnowledgeMap> m_memory = std::make_shared<KnowledgeMap>();
 
 	KnowledgeBase m_knowledgeBase;
 
@@ -36,6 +36,7 @@ using namespace solidity::yul;
 void DeadCodeEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
 	DeadCodeEliminator{_context.dialect}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void DeadCodeEliminator::operator()(ForLoop& _for)
@@ -27,9 +27,10 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
-void EquivalentFunctionCombiner::run(OptimiserStepContext&, Block& _ast)
+void EquivalentFunctionCombiner::run(OptimiserStepContext& _context, Block& _ast)
 {
 	EquivalentFunctionCombiner{EquivalentFunctionDetector::run(_ast)}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void EquivalentFunctionCombiner::operator()(FunctionCall& _funCall)
@@ -40,6 +40,7 @@ void ExpressionInliner::run(OptimiserStepContext& _context, Block& _ast)
 	funFinder(_ast);
 	ExpressionInliner inliner{_context.dialect, funFinder.inlinableFunctions()};
 	inliner(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void ExpressionInliner::operator()(FunctionDefinition& _fun)
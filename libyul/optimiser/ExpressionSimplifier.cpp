@@ -32,6 +32,7 @@ using namespace solidity::yul;
 void ExpressionSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
 	ExpressionSimplifier{_context.dialect}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void ExpressionSimplifier::visit(Expression& _expression)
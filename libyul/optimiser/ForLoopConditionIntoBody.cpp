@@ -29,6 +29,7 @@ using namespace solidity::yul;
 void ForLoopConditionIntoBody::run(OptimiserStepContext& _context, Block& _ast)
 {
 	ForLoopConditionIntoBody{_context.dialect}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void ForLoopConditionIntoBody::operator()(ForLoop& _forLoop)
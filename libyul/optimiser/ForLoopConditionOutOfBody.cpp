@@ -30,6 +30,7 @@ using namespace solidity::yul;
 void ForLoopConditionOutOfBody::run(OptimiserStepContext& _context, Block& _ast)
 {
 	ForLoopConditionOutOfBody{_context.dialect}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void ForLoopConditionOutOfBody::operator()(ForLoop& _forLoop)
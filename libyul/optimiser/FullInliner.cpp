@@ -34,19 +34,47 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/Visitor.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner inliner{_ast, _context.dispenser, _context.dialect};
+	runWithStatistics(_context, _ast);
+}
+
+FullInliner::Statistics FullInliner::runWithStatistics(OptimiserStepContext& _context, Block& _ast)
+{
+	FullInliner inliner{
+		_ast,
+		_context.dispenser,
+		_context.dialect,
+		_context.callGraphAnalysis,
+		_context.expectedExecutionsPerDeployment
+	};
 	inliner.run(Pass::InlineTiny);
 	inliner.run(Pass::InlineRest);
+	// Sizes of functions are updated after each pass, but the size of the global
+	// statements is only estimated.
+	inliner.m_functionSizes[YulString{}] = CodeSize::codeSize(_ast);
+	return {
+		inliner.m_initialCodeSize,
+		inliner.m_codeGrowthBudget,
+		inliner.m_codeGrowth,
+		inliner.totalCodeSize()
+	};
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
-	m_ast(_ast), m_nameDispenser(_dispenser), m_dialect(_dialect)
+FullInliner::FullInliner(
+	Block& _ast,
+	NameDispenser& _dispenser,
+	Dialect const& _dialect,
+	CallGraphAnalysisCache& _callGraphAnalysis,
+	optional<size_t> _expectedExecutionsPerDeployment
+):
+	m_ast(_ast), m_nameDispenser(_dispenser), m_dialect(_dialect), m_callGraphAnalysis(_callGraphAnalysis)
 {
 	// Determine constants
 	SSAValueTracker tracker;
@@ -71,6 +99,10 @@ FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const&
 			m_singleUse.emplace(fun.name);
 		updateCodeSize(fun);
 	}
+
+	m_initialCodeSize = totalCodeSize();
+	size_t growthFactor = clamp<size_t>(_expectedExecutionsPerDeployment.value_or(1) / 100, 1, 16);
+	m_codeGrowthBudget = growthFactor * m_initialCodeSize;
 }
 
 void FullInliner::run(Pass _pass)
@@ -107,9 +139,9 @@ void FullInliner::run(Pass _pass)
 			handleBlock({}, std::get<Block>(statement));
 }
 
-map<YulString, size_t> FullInliner::callDepths() const
+map<YulString, size_t> FullInliner::callDepths()
 {
-	CallGraph cg = CallGraphGenerator::callGraph(m_ast);
+	CallGraph cg = m_callGraphAnalysis.analyze(m_dialect, m_ast).callGraph;
 	cg.functionCalls.erase(""_yulstring);
 
 	// Remove calls to builtin functions.
@@ -184,6 +216,10 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 	if (m_singleUse.count(calledFunction->name))
 		return true;
 
+	// Stop duplicating code once the total growth exceeds the budget.
+	if (m_codeGrowth + size > m_codeGrowthBudget)
+		return false;
+
 	// Constant arguments might provide a means for further optimization, so they cause a bonus.
 	bool constantArg = false;
 	for (auto const& argument: _funCall.arguments)
@@ -201,12 +237,26 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 
 void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _callSite)
 {
-	m_functionSizes.at(_callSite) += m_functionSizes.at(_function);
+	size_t size = m_functionSizes.at(_function);
+	m_functionSizes.at(_callSite) += size;
+	// The call site now calls the functions called by _function instead.
+	m_callGraphAnalysis.invalidate();
+	if (size > 1 && !m_singleUse.count(_function))
+		m_codeGrowth += size;
 }
 
 void FullInliner::updateCodeSize(FunctionDefinition const& _fun)
 {
 	m_functionSizes[_fun.name] = CodeSize::codeSize(_fun.body);
+	m_recursive.erase(_fun.name);
+}
+
+size_t FullInliner::totalCodeSize() const
+{
+	size_t size = 0;
+	for (auto const& [function, functionSize]: m_functionSizes)
+		size += functionSize;
+	return size;
 }
 
 void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
@@ -214,10 +264,12 @@ void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
 	InlineModifier{*this, m_nameDispenser, _currentFunctionName, m_dialect}(_block);
 }
 
-bool FullInliner::recursive(FunctionDefinition const& _fun) const
+bool FullInliner::recursive(FunctionDefinition const& _fun)
 {
+	if (bool const* isRecursive = util::valueOrNullptr(m_recursive, _fun.name))
+		return *isRecursive;
 	map<YulString, size_t> references = ReferencesCounter::countReferences(_fun);
-	return references[_fun.name] > 0;
+	return m_recursive[_fun.name] = references[_fun.name] > 0;
 }
 
 void InlineModifier::operator()(Block& _block)
@@ -64,6 +64,14 @@ class NameCollector;
  * code of f, with replacements: a -> f_a, b -> f_b, c -> f_c
  * let z := f_c
  *
+ * Inlining functions that are neither tiny nor called only once duplicates code.
+ * The duplicated code has to be paid for once at deployment, while the call it
+ * replaces is saved on every execution. Because of that, the estimated total growth
+ * caused by this is limited to the initial size of the code multiplied by the expected
+ * number of executions per deployment divided by 100, but by at least one and at most 16.
+ * Creation code counts as executed once. With the default of 200 expected executions,
+ * the code can grow to three times its initial size.
+ *
  * Prerequisites: Disambiguator
  * More efficient if run after: Function Hoister, Expression Splitter
  */
@@ -73,6 +81,19 @@ public:
 	static constexpr char const* name{"FullInliner"};
 	static void run(OptimiserStepContext& _context, Block& _ast);
 
+	/// Code sizes, as measured by CodeSize, related to one run of the inliner.
+	struct Statistics
+	{
+		size_t initialCodeSize = 0;
+		/// Limit for the estimated code growth derived from the initial size.
+		size_t codeGrowthBudget = 0;
+		/// Code growth estimated during inlining and checked against the budget.
+		size_t estimatedCodeGrowth = 0;
+		size_t finalCodeSize = 0;
+	};
+	/// Runs the inliner and @returns the planned and the actual code growth.
+	static Statistics runWithStatistics(OptimiserStepContext& _context, Block& _ast);
+
 	/// Inlining heuristic.
 	/// @param _callSite the name of the function in which the function call is located.
 	bool shallInline(FunctionCall const& _funCall, YulString _callSite);
@@ -93,16 +114,27 @@ public:
 private:
 	enum Pass { InlineTiny, InlineRest };
 
-	FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect);
+	FullInliner(
+		Block& _ast,
+		NameDispenser& _dispenser,
+		Dialect const& _dialect,
+		CallGraphAnalysisCache& _callGraphAnalysis,
+		std::optional<size_t> _expectedExecutionsPerDeployment
+	);
 	void run(Pass _pass);
 
 	/// @returns a map containing the maximum depths of a call chain starting at each
 	/// function. For recursive functions, the value is one larger than for all others.
-	std::map<YulString, size_t> callDepths() const;
+	/// Uses the call graph of @a m_callGraphAnalysis, which is invalidated whenever
+	/// a call is inlined.
+	std::map<YulString, size_t> callDepths();
 
 	void updateCodeSize(FunctionDefinition const& _fun);
+	size_t totalCodeSize() const;
 	void handleBlock(YulString _currentFunctionName, Block& _block);
-	bool recursive(FunctionDefinition const& _fun) const;
+	/// @returns true if the function calls itself directly. The result is cached
+	/// until the body of the function is modified.
+	bool recursive(FunctionDefinition const& _fun);
 
 	Pass m_pass;
 	/// The AST to be modified. The root block itself will not be modified, because
@@ -116,8 +148,15 @@ private:
 	/// Variables that are constants (used for inlining heuristic)
 	std::set<YulString> m_constants;
 	std::map<YulString, size_t> m_functionSizes;
+	std::map<YulString, bool> m_recursive;
+	size_t m_initialCodeSize = 0;
+	/// Estimated code growth caused by inlining functions that are neither tiny
+	/// nor used only once, and the limit for it.
+	size_t m_codeGrowth = 0;
+	size_t m_codeGrowthBudget = 0;
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
+	CallGraphAnalysisCache& m_callGraphAnalysis;
 };
 
 /**
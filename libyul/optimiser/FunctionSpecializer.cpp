@@ -128,7 +128,7 @@ FunctionDefinition FunctionSpecializer::specialize(
 void FunctionSpecializer::run(OptimiserStepContext& _context, Block& _ast)
 {
 	FunctionSpecializer f{
-		CallGraphGenerator::callGraph(_ast).recursiveFunctions(),
+		_context.callGraphAnalysis.analyze(_context.dialect, _ast).recursiveFunctions,
 		_context.dispenser,
 		_context.dialect
 	};
@@ -155,4 +155,5 @@ void FunctionSpecializer::run(OptimiserStepContext& _context, Block& _ast)
 
 		return nullopt;
 	});
+	_context.callGraphAnalysis.invalidate();
 }
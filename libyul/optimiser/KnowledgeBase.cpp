@@ -22,6 +22,7 @@
 #include <libyul/optimiser/KnowledgeBase.h>
 
 #include <libyul/AST.h>
+#include <libyul/Dialect.h>
 #include <libyul/Utilities.h>
 #include <libyul/optimiser/SimplificationRules.h>
 #include <libyul/optimiser/DataFlowAnalyzer.h>
@@ -36,6 +37,10 @@ using namespace solidity::yul;
 
 bool KnowledgeBase::knownToBeDifferent(YulString _a, YulString _b)
 {
+	if (optional<u256> difference = differenceOfOffsets(_a, _b))
+		return *difference != 0;
+
+	++m_statistics.simplifications;
 	// Try to use the simplification rules together with the
 	// current values to turn `sub(_a, _b)` into a nonzero constant.
 	// If that fails, try `eq(_a, _b)`.
@@ -53,6 +58,10 @@ bool KnowledgeBase::knownToBeDifferent(YulString _a, YulString _b)
 
 bool KnowledgeBase::knownToBeDifferentByAtLeast32(YulString _a, YulString _b)
 {
+	if (optional<u256> difference = differenceOfOffsets(_a, _b))
+		return *difference >= 32 && *difference <= u256(0) - 32;
+
+	++m_statistics.simplifications;
 	// Try to use the simplification rules together with the
 	// current values to turn `sub(_a, _b)` into a constant whose absolute value is at least 32.
 
@@ -66,6 +75,88 @@ bool KnowledgeBase::knownToBeDifferentByAtLeast32(YulString _a, YulString _b)
 	return false;
 }
 
+void KnowledgeBase::valueChanged(YulString _variable)
+{
+	// Entries can depend on each other, so we do not try to find the affected ones.
+	if (m_offsetDependencies.count(_variable))
+		reset();
+}
+
+void KnowledgeBase::reset()
+{
+	m_offsets.clear();
+	m_offsetDependencies.clear();
+}
+
+optional<u256> KnowledgeBase::differenceOfOffsets(YulString _a, YulString _b)
+{
+	VariableOffset offsetA = explore(_a, 0);
+	VariableOffset offsetB = explore(_b, 0);
+	if (offsetA.reference == offsetB.reference)
+		return offsetA.offset - offsetB.offset;
+	return nullopt;
+}
+
+KnowledgeBase::VariableOffset KnowledgeBase::explore(YulString _variable, size_t _depth)
+{
+	if (VariableOffset const* offset = util::valueOrNullptr(m_offsets, _variable))
+	{
+		++m_statistics.offsetCacheHits;
+		return *offset;
+	}
+	++m_statistics.offsetCacheMisses;
+
+	// Stop following very long chains, but do not cache the truncated result.
+	if (_depth > 100)
+		return VariableOffset{_variable, 0};
+
+	optional<VariableOffset> result;
+	if (AssignedValue const* value = util::valueOrNullptr(m_variableValues, _variable))
+		if (value->value)
+			result = explore(*value->value, _depth + 1);
+	if (!result)
+		result = VariableOffset{_variable, 0};
+
+	m_offsetDependencies.insert(_variable);
+	m_offsets[_variable] = *result;
+	return *result;
+}
+
+optional<KnowledgeBase::VariableOffset> KnowledgeBase::explore(Expression const& _value, size_t _depth)
+{
+	if (Literal const* literal = get_if<Literal>(&_value))
+		return VariableOffset{YulString{}, valueOfLiteral(*literal)};
+	else if (Identifier const* identifier = get_if<Identifier>(&_value))
+		return explore(identifier->name, _depth);
+	else if (FunctionCall const* call = get_if<FunctionCall>(&_value))
+	{
+		YulString name = call->functionName.name;
+		if (call->arguments.size() != 2 || !m_dialect.builtin(name))
+			return nullopt;
+		if (name == "add"_yulstring)
+		{
+			optional<VariableOffset> first = explore(call->arguments.at(0), _depth);
+			optional<VariableOffset> second = explore(call->arguments.at(1), _depth);
+			if (first && second && (first->reference.empty() || second->reference.empty()))
+				return VariableOffset{
+					first->reference.empty() ? second->reference : first->reference,
+					first->offset + second->offset
+				};
+		}
+		else if (name == "sub"_yulstring)
+		{
+			optional<VariableOffset> first = explore(call->arguments.at(0), _depth);
+			optional<VariableOffset> second = explore(call->arguments.at(1), _depth);
+			if (first && second && (second->reference.empty() || first->reference == second->reference))
+				return VariableOffset{
+					second->reference.empty() ? first->reference : YulString{},
+					first->offset - second->offset
+				};
+		}
+	}
+	return nullopt;
+}
+
 Expression KnowledgeBase::simplify(Expression _expression)
 {
 	bool startedRecursion = (m_recursionCounter == 0);
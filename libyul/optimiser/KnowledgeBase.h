@@ -24,7 +24,12 @@
 #include <libyul/ASTForward.h>
 #include <libyul/YulString.h>
 
+#include <libsolutil/Common.h>
+
 #include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace solidity::yul
 {
@@ -36,6 +41,13 @@ struct AssignedValue;
  * Class that can answer questions about values of variables and their relations.
  *
  * The reference to the map of values provided at construction is assumed to be updating.
+ * Changes to the value of a variable have to be reported via @a valueChanged.
+ *
+ * Questions about the difference of two variables are first answered by expressing both
+ * as a common base variable plus a constant offset (following the chain of
+ * `add` / `sub` with constants through the known values). These forms are cached until
+ * a value they were derived from changes. Only if the base variables differ, the
+ * simplification rules are run on `sub(a, b)` / `eq(a, b)`.
  */
 class KnowledgeBase
 {
@@ -49,12 +61,45 @@ public:
 	bool knownToBeDifferentByAtLeast32(YulString _a, YulString _b);
 	bool knownToBeEqual(YulString _a, YulString _b) const { return _a == _b; }
 
+	/// Has to be called whenever the value of @a _variable is assigned or removed.
+	void valueChanged(YulString _variable);
+	/// Has to be called whenever the map of values is replaced as a whole.
+	void reset();
+
+	struct Statistics
+	{
+		/// Lookups of the base + offset form of a variable that were answered from the cache.
+		size_t offsetCacheHits = 0;
+		size_t offsetCacheMisses = 0;
+		/// Queries that had to fall back to the simplification rules.
+		size_t simplifications = 0;
+	};
+	Statistics const& statistics() const { return m_statistics; }
+
 private:
+	/// Value of a variable expressed as `reference + offset`. An empty reference
+	/// means that the value is the constant `offset`.
+	struct VariableOffset
+	{
+		YulString reference;
+		u256 offset;
+	};
+
+	/// @returns the difference `_a - _b` if it does not depend on any unknown values.
+	std::optional<u256> differenceOfOffsets(YulString _a, YulString _b);
+	VariableOffset explore(YulString _variable, size_t _depth);
+	std::optional<VariableOffset> explore(Expression const& _value, size_t _depth);
+
 	Expression simplify(Expression _expression);
 
 	Dialect const& m_dialect;
 	std::map<YulString, AssignedValue> const& m_variableValues;
 	size_t m_recursionCounter = 0;
+
+	std::unordered_map<YulString, VariableOffset> m_offsets;
+	/// Variables whose values were used to compute the entries in m_offsets.
+	std::unordered_set<YulString> m_offsetDependencies;
+	Statistics m_statistics;
 };
 
 }
@@ -43,13 +43,14 @@ using namespace solidity::yul;
 
 void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 {
-	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	auto const& analysis = _context.callGraphAnalysis.analyze(_context.dialect, _ast);
 	LoadResolver{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
-		containsMSize,
+		analysis.functionSideEffects,
+		analysis.containsMSize,
 		_context.expectedExecutionsPerDeployment
 	}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void LoadResolver::visit(Expression& _e)
@@ -82,12 +83,12 @@ void LoadResolver::tryResolve(
 	YulString key = std::get<Identifier>(_arguments.at(0)).name;
 	if (_location == StoreLoadLocation::Storage)
 	{
-		if (auto value = util::valueOrNullptr(m_storage, key))
+		if (auto value = util::valueOrNullptr(m_storage->values, key))
 			if (inScope(*value))
 				_e = Identifier{debugDataOf(_e), *value};
 	}
 	else if (!m_containsMSize && _location == StoreLoadLocation::Memory)
-		if (auto value = util::valueOrNullptr(m_memory, key))
+		if (auto value = util::valueOrNullptr(m_memory->values, key))
 			if (inScope(*value))
 				_e = Identifier{debugDataOf(_e), *value};
 }
@@ -129,7 +130,7 @@ void LoadResolver::tryEvaluateKeccak(
 	if (!memoryKey || !length)
 		return;
 
-	auto memoryValue = util::valueOrNullptr(m_memory, memoryKey->name);
+	auto memoryValue = util::valueOrNullptr(m_memory->values, memoryKey->name);
 	if (memoryValue && inScope(*memoryValue))
 	{
 		optional<u256> memoryContent = valueOfIdentifier(*memoryValue);
@@ -33,11 +33,9 @@ using namespace solidity::yul;
 
 void LoopInvariantCodeMotion::run(OptimiserStepContext& _context, Block& _ast)
 {
-	map<YulString, SideEffects> functionSideEffects =
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
-	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	auto const& analysis = _context.callGraphAnalysis.analyze(_context.dialect, _ast);
 	set<YulString> ssaVars = SSAValueTracker::ssaVariables(_ast);
-	LoopInvariantCodeMotion{_context.dialect, ssaVars, functionSideEffects, containsMSize}(_ast);
+	LoopInvariantCodeMotion{_context.dialect, ssaVars, analysis.functionSideEffects, analysis.containsMSize}(_ast);
 }
 
 void LoopInvariantCodeMotion::operator()(Block& _block)
@@ -23,6 +23,7 @@
 #include <libyul/optimiser/MainFunction.h>
 
 #include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/Exceptions.h>
 
 #include <libyul/AST.h>
@@ -33,6 +34,12 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
+void MainFunction::run(OptimiserStepContext& _context, Block& _ast)
+{
+	MainFunction{}(_ast);
+	_context.callGraphAnalysis.invalidate();
+}
+
 void MainFunction::operator()(Block& _block)
 {
 	assertThrow(_block.statements.size() >= 1, OptimizerException, "");
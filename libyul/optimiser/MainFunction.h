@@ -36,7 +36,7 @@ class MainFunction
 {
 public:
 	static constexpr char const* name{"MainFunction"};
-	static void run(OptimiserStepContext&, Block& _ast) { MainFunction{}(_ast); }
+	static void run(OptimiserStepContext& _context, Block& _ast);
 
 	void operator()(Block& _block);
 
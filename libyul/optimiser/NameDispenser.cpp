@@ -29,6 +29,9 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <algorithm>
+#include <string_view>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -41,21 +44,55 @@ NameDispenser::NameDispenser(Dialect const& _dialect, Block const& _ast, set<Yul
 }
 
 NameDispenser::NameDispenser(Dialect const& _dialect, set<YulString> _usedNames):
-	m_dialect(_dialect),
-	m_usedNames(std::move(_usedNames))
+	m_dialect(_dialect)
 {
+	markAllUsed(_usedNames);
 }
 
 YulString NameDispenser::newName(YulString _nameHint)
 {
-	YulString name = _nameHint;
-	while (illegalName(name))
+	if (!illegalName(_nameHint))
+	{
+		markUsed(_nameHint);
+		return _nameHint;
+	}
+
+	unordered_set<size_t> const* usedSuffixes = valueOrNullptr(m_usedSuffixes, _nameHint);
+	while (true)
 	{
 		m_counter++;
-		name = YulString(_nameHint.str() + "_" + to_string(m_counter));
+		if (usedSuffixes)
+			while (usedSuffixes->count(m_counter))
+				m_counter++;
+		YulString name(_nameHint.str() + "_" + to_string(m_counter));
+		if (!illegalName(name))
+		{
+			markUsed(name);
+			return name;
+		}
 	}
-	m_usedNames.emplace(name);
-	return name;
+}
+
+void NameDispenser::markUsed(YulString _name)
+{
+	if (!m_usedNames.insert(_name).second)
+		return;
+
+	string const& name = _name.str();
+	size_t separator = name.rfind('_');
+	if (separator == string::npos || separator == 0)
+		return;
+	// Only suffixes in the form produced by to_string are relevant. Longer suffixes are
+	// not indexed, newName still checks the full name.
+	string_view suffix = string_view(name).substr(separator + 1);
+	if (
+		suffix.empty() ||
+		suffix.size() > 9 ||
+		suffix.front() == '0' ||
+		!all_of(suffix.begin(), suffix.end(), [](char _c) { return '0' <= _c && _c <= '9'; })
+	)
+		return;
+	m_usedSuffixes[YulString(name.substr(0, separator))].insert(static_cast<size_t>(stoul(string(suffix))));
 }
 
 bool NameDispenser::illegalName(YulString _name)
@@ -65,6 +102,16 @@ bool NameDispenser::illegalName(YulString _name)
 
 void NameDispenser::reset(Block const& _ast)
 {
-	m_usedNames = NameCollector(_ast).names() + m_reservedNames;
+	m_usedNames.clear();
+	m_usedSuffixes.clear();
+	markAllUsed(NameCollector(_ast).names());
+	markAllUsed(m_reservedNames);
 	m_counter = 0;
 }
+
+template<typename Names>
+void NameDispenser::markAllUsed(Names const& _names)
+{
+	for (YulString name: _names)
+		markUsed(name);
+}
@@ -25,6 +25,8 @@
 #include <libyul/YulString.h>
 
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace solidity::yul
 {
@@ -35,6 +37,8 @@ struct Dialect;
  * do not conflict with existing names.
  *
  * Tries to keep names short and appends decimals to disambiguate.
+ * The decimals come from a single counter shared by all names, so the
+ * generated names only depend on the order of the requests.
  */
 class NameDispenser
 {
@@ -49,9 +53,7 @@ public:
 
 	/// Mark @a _name as used, i.e. the dispenser's newName function will not
 	/// return it.
-	void markUsed(YulString _name) { m_usedNames.insert(_name); }
-
-	std::set<YulString> const& usedNames() { return m_usedNames; }
+	void markUsed(YulString _name);
 
 	/// Returns true if `_name` is either used or is a restricted identifier.
 	bool illegalName(YulString _name);
@@ -61,8 +63,15 @@ public:
 	void reset(Block const& _ast);
 
 private:
+	/// Marks all names in @a _names as used.
+	template<typename Names>
+	void markAllUsed(Names const& _names);
+
 	Dialect const& m_dialect;
-	std::set<YulString> m_usedNames;
+	std::unordered_set<YulString> m_usedNames;
+	/// m_usedSuffixes[base].count(n) <=> m_usedNames.count(base + "_" + to_string(n))
+	/// Used to skip the suffixes that are already taken without constructing the names.
+	std::unordered_map<YulString, std::unordered_set<size_t>> m_usedSuffixes;
 	std::set<YulString> m_reservedNames;
 	size_t m_counter = 0;
 };
@@ -48,6 +48,7 @@ public:
 	static void run(OptimiserStepContext& _context, Block& _ast)
 	{
 		NameSimplifier{_context, _ast}(_ast);
+		_context.callGraphAnalysis.invalidate();
 	}
 
 	using ASTModifier::operator();
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <libyul/optimiser/CallGraphAnalysisCache.h>
 #include <libyul/Exceptions.h>
 
 #include <optional>
@@ -34,11 +35,17 @@ class NameDispenser;
 
 struct OptimiserStepContext
 {
+	static constexpr size_t defaultReasoningBasedSimplifierMaxChecks = 1000;
+
 	Dialect const& dialect;
 	NameDispenser& dispenser;
 	std::set<YulString> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Maximum number of SMT solver queries the ReasoningBasedSimplifier makes per function.
+	size_t reasoningBasedSimplifierMaxChecks = defaultReasoningBasedSimplifierMaxChecks;
+	/// Function side-effects and related information of the full AST, shared between steps.
+	CallGraphAnalysisCache callGraphAnalysis{};
 };
 
 
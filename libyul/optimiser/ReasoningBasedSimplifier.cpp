@@ -22,11 +22,13 @@
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/AST.h>
 #include <libyul/Dialect.h>
+#include <libyul/Utilities.h>
 
 #include <libsmtutil/SMTPortfolio.h>
 #include <libsmtutil/Helpers.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Visitor.h>
 
 #include <utility>
 #include <memory>
@@ -40,7 +42,8 @@ using namespace solidity::smtutil;
 void ReasoningBasedSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
 	set<YulString> ssaVars = SSAValueTracker::ssaVariables(_ast);
-	ReasoningBasedSimplifier{_context.dialect, ssaVars}(_ast);
+	ReasoningBasedSimplifier{_context.dialect, ssaVars, _context.reasoningBasedSimplifierMaxChecks}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 std::optional<string> ReasoningBasedSimplifier::invalidInCurrentEnvironment()
@@ -62,17 +65,63 @@ void ReasoningBasedSimplifier::operator()(If& _if)
 	if (!SideEffectsCollector{m_dialect, *_if.condition}.movable())
 		return;
 
+	ConditionValue value = conditionValue(*_if.condition);
+	if (value == ConditionValue::AlwaysTrue)
+	{
+		Literal trueCondition = m_dialect.trueLiteral();
+		trueCondition.debugData = debugDataOf(*_if.condition);
+		_if.condition = make_unique<yul::Expression>(move(trueCondition));
+	}
+	else if (value == ConditionValue::AlwaysFalse)
+	{
+		Literal falseCondition = m_dialect.zeroLiteralForType(m_dialect.boolType);
+		falseCondition.debugData = debugDataOf(*_if.condition);
+		_if.condition = make_unique<yul::Expression>(move(falseCondition));
+		_if.body = yul::Block{};
+		// Nothing left to be done.
+		return;
+	}
+
 	smtutil::Expression condition = encodeExpression(*_if.condition);
 	m_solver->push();
+	m_solver->addAssertion(condition != constantValue(0));
+	m_scopes.emplace_back(m_numScopes++);
+
+	ASTModifier::operator()(_if.body);
+
+	m_scopes.pop_back();
+	m_solver->pop();
+}
+
+void ReasoningBasedSimplifier::operator()(FunctionDefinition& _function)
+{
+	ScopedSaveAndRestore remainingChecks(m_remainingChecks, size_t(m_maxChecksPerFunction));
+	ASTModifier::operator()(_function);
+}
+
+ReasoningBasedSimplifier::ConditionValue ReasoningBasedSimplifier::conditionValue(yul::Expression const& _condition)
+{
+	string key = conditionKey(_condition);
+	// Constraints are only added in inner scopes or on new variables, so a definite
+	// result stays valid in the same scope and all inner scopes.
+	for (size_t scope: m_scopes)
+		if (auto const* value = valueOrNullptr(m_conditionValues, make_pair(scope, key)))
+			if (*value != ConditionValue::Unknown || scope == m_scopes.back())
+				return *value;
+
+	// Both queries below together only count as one check.
+	if (m_remainingChecks == 0)
+		return ConditionValue::Unknown;
+	--m_remainingChecks;
+
+	ConditionValue value = ConditionValue::Unknown;
+	smtutil::Expression condition = encodeExpression(_condition);
+	m_solver->push();
 	m_solver->addAssertion(condition == constantValue(0));
 	CheckResult result = m_solver->check({}).first;
 	m_solver->pop();
 	if (result == CheckResult::UNSATISFIABLE)
-	{
-		Literal trueCondition = m_dialect.trueLiteral();
-		trueCondition.debugData = debugDataOf(*_if.condition);
-		_if.condition = make_unique<yul::Expression>(move(trueCondition));
-	}
+		value = ConditionValue::AlwaysTrue;
 	else
 	{
 		m_solver->push();
@@ -80,30 +129,42 @@ void ReasoningBasedSimplifier::operator()(If& _if)
 		CheckResult result2 = m_solver->check({}).first;
 		m_solver->pop();
 		if (result2 == CheckResult::UNSATISFIABLE)
-		{
-			Literal falseCondition = m_dialect.zeroLiteralForType(m_dialect.boolType);
-			falseCondition.debugData = debugDataOf(*_if.condition);
-			_if.condition = make_unique<yul::Expression>(move(falseCondition));
-			_if.body = yul::Block{};
-			// Nothing left to be done.
-			return;
-		}
+			value = ConditionValue::AlwaysFalse;
 	}
+	m_conditionValues[{m_scopes.back(), key}] = value;
+	return value;
+}
 
-	m_solver->push();
-	m_solver->addAssertion(condition != constantValue(0));
-
-	ASTModifier::operator()(_if.body);
-
-	m_solver->pop();
+string ReasoningBasedSimplifier::conditionKey(yul::Expression const& _expression)
+{
+	return std::visit(GenericVisitor{
+		[&](FunctionCall const& _functionCall) -> string
+		{
+			string key = _functionCall.functionName.name.str() + "(";
+			for (auto const& argument: _functionCall.arguments)
+				key += conditionKey(argument) + ",";
+			return key + ")";
+		},
+		[&](Identifier const& _identifier) -> string
+		{
+			return _identifier.name.str();
+		},
+		[&](Literal const& _literal) -> string
+		{
+			return valueOfLiteral(_literal).str();
+		}
+	}, _expression);
 }
 
 ReasoningBasedSimplifier::ReasoningBasedSimplifier(
 	Dialect const& _dialect,
-	set<YulString> const& _ssaVariables
+	set<YulString> const& _ssaVariables,
+	size_t _maxChecksPerFunction
 ):
 	SMTSolver(_ssaVariables, _dialect),
-	m_dialect(_dialect)
+	m_dialect(_dialect),
+	m_maxChecksPerFunction(_maxChecksPerFunction),
+	m_remainingChecks(_maxChecksPerFunction)
 {
 }
 
@@ -25,6 +25,9 @@
 #include <libyul/backends/evm/EVMDialect.h>
 
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace solidity::smtutil
 {
@@ -45,6 +48,11 @@ namespace solidity::yul
  *
  * It is only effective on the EVM dialect, but safe to use on other dialects.
  *
+ * The results are cached by the condition and the innermost enclosing `if` body, since
+ * variable declarations only add constraints on new variables. At most
+ * `OptimiserStepContext::reasoningBasedSimplifierMaxChecks` solver queries are made per
+ * function; further conditions are left unchanged. This is a deterministic bound, unlike a time limit.
+ *
  * Prerequisite: Disambiguator, SSATransform.
  */
 class ReasoningBasedSimplifier: public ASTModifier, SMTSolver
@@ -57,11 +65,20 @@ public:
 	using ASTModifier::operator();
 	void operator()(VariableDeclaration& _varDecl) override;
 	void operator()(If& _if) override;
+	void operator()(FunctionDefinition& _function) override;
 
 private:
+	enum class ConditionValue { AlwaysTrue, AlwaysFalse, Unknown };
+
+	/// @returns the value of @a _condition under the current constraints, using the cache if possible.
+	ConditionValue conditionValue(Expression const& _condition);
+	/// @returns a string that identifies the expression up to the names of non-SSA variables.
+	static std::string conditionKey(Expression const& _expression);
+
 	explicit ReasoningBasedSimplifier(
 		Dialect const& _dialect,
-		std::set<YulString> const& _ssaVariables
+		std::set<YulString> const& _ssaVariables,
+		size_t _maxChecksPerFunction
 	);
 
 	smtutil::Expression encodeEVMBuiltin(
@@ -70,6 +87,12 @@ private:
 	) override;
 
 	Dialect const& m_dialect;
+	/// Identifiers of the enclosing `if` bodies, outermost first.
+	std::vector<size_t> m_scopes{0};
+	size_t m_numScopes = 1;
+	std::map<std::pair<size_t, std::string>, ConditionValue> m_conditionValues;
+	size_t const m_maxChecksPerFunction;
+	size_t m_remainingChecks;
 };
 
 }
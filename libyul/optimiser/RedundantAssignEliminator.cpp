@@ -40,6 +40,7 @@ void RedundantAssignEliminator::run(OptimiserStepContext& _context, Block& _ast)
 
 	AssignmentRemover remover{rae.m_pendingRemovals};
 	remover(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void RedundantAssignEliminator::operator()(Identifier const& _identifier)
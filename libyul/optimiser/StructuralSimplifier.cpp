@@ -57,9 +57,10 @@ OptionalStatements replaceConstArgSwitch(Switch& _switchStmt, u256 const& _const
 
 }
 
-void StructuralSimplifier::run(OptimiserStepContext&, Block& _ast)
+void StructuralSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
 	StructuralSimplifier{}(_ast);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void StructuralSimplifier::operator()(Block& _block)
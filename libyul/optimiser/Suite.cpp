@@ -89,7 +89,8 @@ void OptimiserSuite::run(
 	bool _optimizeStackAllocation,
 	string const& _optimisationSequence,
 	optional<size_t> _expectedExecutionsPerDeployment,
-	set<YulString> const& _externallyUsedIdentifiers
+	set<YulString> const& _externallyUsedIdentifiers,
+	size_t _reasoningBasedSimplifierMaxChecks
 )
 {
 	set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
@@ -103,6 +104,7 @@ void OptimiserSuite::run(
 	Block& ast = *_object.code;
 
 	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast, _expectedExecutionsPerDeployment);
+	suite.m_context.reasoningBasedSimplifierMaxChecks = _reasoningBasedSimplifierMaxChecks;
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
@@ -124,6 +126,7 @@ void OptimiserSuite::run(
 		_optimizeStackAllocation,
 		stackCompressorMaxIterations
 	);
+	suite.m_context.callGraphAnalysis.invalidate();
 	suite.runSequence("fDnTOc g", ast);
 
 	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&_dialect))
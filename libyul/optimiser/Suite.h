@@ -66,7 +66,8 @@ public:
 		bool _optimizeStackAllocation,
 		std::string const& _optimisationSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		size_t _reasoningBasedSimplifierMaxChecks = OptimiserStepContext::defaultReasoningBasedSimplifierMaxChecks
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
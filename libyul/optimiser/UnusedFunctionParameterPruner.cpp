@@ -124,4 +124,5 @@ void UnusedFunctionParameterPruner::run(OptimiserStepContext& _context, Block& _
 
 		return nullopt;
 	});
+	_context.callGraphAnalysis.invalidate();
 }
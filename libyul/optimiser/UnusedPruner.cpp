@@ -29,6 +29,11 @@
 #include <libyul/Dialect.h>
 #include <libyul/SideEffects.h>
 
+#include <libsolutil/CommonData.h>
+
+#include <algorithm>
+#include <optional>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -65,64 +70,170 @@ UnusedPruner::UnusedPruner(
 
 void UnusedPruner::operator()(Block& _block)
 {
-	for (auto&& statement: _block.statements)
-		if (holds_alternative<FunctionDefinition>(statement))
+	size_t blockIndex = m_blocks.size();
+	m_blocks.emplace_back();
+	m_blocks.back().block = &_block;
+
+	for (size_t i = 0; i < _block.statements.size(); ++i)
+	{
+		StatementPosition position{blockIndex, i};
+		m_worklist.emplace(1, blockIndex, i);
+		if (auto const* funDef = get_if<FunctionDefinition>(&_block.statements[i]))
+			m_definitions[funDef->name].emplace_back(position);
+		else if (auto const* varDecl = get_if<VariableDeclaration>(&_block.statements[i]))
+			for (auto const& var: varDecl->variables)
+				m_definitions[var.name].emplace_back(position);
+	}
+
+	for (size_t i = 0; i < _block.statements.size(); ++i)
+	{
+		size_t firstNestedBlock = m_blocks.size();
+		visit(_block.statements[i]);
+		if (holds_alternative<FunctionDefinition>(_block.statements[i]))
+			m_functionBodies[{blockIndex, i}] = {firstNestedBlock, m_blocks.size()};
+		else if (holds_alternative<Block>(_block.statements[i]))
+			m_blocks[blockIndex].nestedBlocks[i] = firstNestedBlock;
+	}
+}
+
+void UnusedPruner::prune()
+{
+	// The worklist is ordered by run and then by the order in which the statements
+	// are visited by a run, which is the order of the blocks and then the order inside
+	// each block. A definition that becomes unused is re-visited in the same run
+	// if it comes later in that order, otherwise in the next run.
+	while (!m_worklist.empty())
+	{
+		auto [run, blockIndex, statementIndex] = *m_worklist.begin();
+		m_worklist.erase(m_worklist.begin());
+		if (!m_blocks[blockIndex].removed && !m_removedInRun.count({blockIndex, statementIndex}))
+			visitStatement(run, {blockIndex, statementIndex});
+	}
+	removeEmptyBlocks();
+}
+
+void UnusedPruner::visitStatement(size_t _run, StatementPosition const& _position)
+{
+	Statement& statement = m_blocks[_position.first].block->statements[_position.second];
+	if (holds_alternative<FunctionDefinition>(statement))
+	{
+		FunctionDefinition& funDef = std::get<FunctionDefinition>(statement);
+		if (!used(funDef.name))
 		{
-			FunctionDefinition& funDef = std::get<FunctionDefinition>(statement);
-			if (!used(funDef.name))
-			{
-				subtractReferences(ReferencesCounter::countReferences(funDef.body));
-				statement = Block{std::move(funDef.debugData), {}};
-			}
+			auto [bodyBegin, bodyEnd] = m_functionBodies.at(_position);
+			for (size_t blockIndex = bodyBegin; blockIndex < bodyEnd; ++blockIndex)
+				m_blocks[blockIndex].removed = true;
+			subtractReferences(ReferencesCounter::countReferences(funDef.body), _run, _position);
+			statement = Block{std::move(funDef.debugData), {}};
+			m_removedInRun[_position] = _run;
 		}
-		else if (holds_alternative<VariableDeclaration>(statement))
+	}
+	else if (holds_alternative<VariableDeclaration>(statement))
+	{
+		VariableDeclaration& varDecl = std::get<VariableDeclaration>(statement);
+		// Multi-variable declarations are special. We can only remove it
+		// if all variables are unused and the right-hand-side is either
+		// movable or it returns a single value. In the latter case, we
+		// replace `let a := f()` by `pop(f())` (in pure Yul, this will be
+		// `drop(f())`).
+		if (std::none_of(
+			varDecl.variables.begin(),
+			varDecl.variables.end(),
+			[&](TypedName const& _typedName) { return used(_typedName.name); }
+		))
 		{
-			VariableDeclaration& varDecl = std::get<VariableDeclaration>(statement);
-			// Multi-variable declarations are special. We can only remove it
-			// if all variables are unused and the right-hand-side is either
-			// movable or it returns a single value. In the latter case, we
-			// replace `let a := f()` by `pop(f())` (in pure Yul, this will be
-			// `drop(f())`).
-			if (std::none_of(
-				varDecl.variables.begin(),
-				varDecl.variables.end(),
-				[&](TypedName const& _typedName) { return used(_typedName.name); }
-			))
+			if (!varDecl.value)
 			{
-				if (!varDecl.value)
-					statement = Block{std::move(varDecl.debugData), {}};
-				else if (
-					SideEffectsCollector(m_dialect, *varDecl.value, m_functionSideEffects).
-					canBeRemoved(m_allowMSizeOptimization)
-				)
-				{
-					subtractReferences(ReferencesCounter::countReferences(*varDecl.value));
-					statement = Block{std::move(varDecl.debugData), {}};
-				}
-				else if (varDecl.variables.size() == 1 && m_dialect.discardFunction(varDecl.variables.front().type))
-					statement = ExpressionStatement{varDecl.debugData, FunctionCall{
-						varDecl.debugData,
-						{varDecl.debugData, m_dialect.discardFunction(varDecl.variables.front().type)->name},
-						{*std::move(varDecl.value)}
-					}};
+				statement = Block{std::move(varDecl.debugData), {}};
+				m_removedInRun[_position] = _run;
 			}
-		}
-		else if (holds_alternative<ExpressionStatement>(statement))
-		{
-			ExpressionStatement& exprStmt = std::get<ExpressionStatement>(statement);
-			if (
-				SideEffectsCollector(m_dialect, exprStmt.expression, m_functionSideEffects).
+			else if (
+				SideEffectsCollector(m_dialect, *varDecl.value, m_functionSideEffects).
 				canBeRemoved(m_allowMSizeOptimization)
 			)
 			{
-				subtractReferences(ReferencesCounter::countReferences(exprStmt.expression));
-				statement = Block{std::move(exprStmt.debugData), {}};
+				subtractReferences(ReferencesCounter::countReferences(*varDecl.value), _run, _position);
+				statement = Block{std::move(varDecl.debugData), {}};
+				m_removedInRun[_position] = _run;
+			}
+			else if (varDecl.variables.size() == 1 && m_dialect.discardFunction(varDecl.variables.front().type))
+				statement = ExpressionStatement{varDecl.debugData, FunctionCall{
+					varDecl.debugData,
+					{varDecl.debugData, m_dialect.discardFunction(varDecl.variables.front().type)->name},
+					{*std::move(varDecl.value)}
+				}};
+		}
+	}
+	else if (holds_alternative<ExpressionStatement>(statement))
+	{
+		ExpressionStatement& exprStmt = std::get<ExpressionStatement>(statement);
+		if (
+			SideEffectsCollector(m_dialect, exprStmt.expression, m_functionSideEffects).
+			canBeRemoved(m_allowMSizeOptimization)
+		)
+		{
+			subtractReferences(ReferencesCounter::countReferences(exprStmt.expression), _run, _position);
+			statement = Block{std::move(exprStmt.debugData), {}};
+			m_removedInRun[_position] = _run;
+		}
+	}
+}
+
+void UnusedPruner::removeEmptyBlocks()
+{
+	// Every run removes the empty blocks directly inside a block before visiting
+	// the nested blocks. Statements replaced by empty blocks are thus removed in the
+	// same run, while a nested block that became empty in some run is removed in the
+	// next run, if there is one.
+	size_t const finalRun = m_lastRunWithRemovals + 1;
+	// Run in which the block lost its last statement (0 if it was empty from the start).
+	vector<optional<size_t>> emptySince(m_blocks.size());
+	// Nested blocks have larger indices than the blocks containing them.
+	for (size_t blockIndex = m_blocks.size(); blockIndex-- > 0;)
+	{
+		BlockInfo const& info = m_blocks[blockIndex];
+		if (info.removed)
+			continue;
+		vector<Statement>& statements = info.block->statements;
+		vector<bool> toRemove(statements.size(), false);
+		size_t lastRemoval = 0;
+		for (size_t i = 0; i < statements.size(); ++i)
+		{
+			optional<size_t> removedInRun;
+			if (size_t const* run = util::valueOrNullptr(m_removedInRun, StatementPosition{blockIndex, i}))
+				removedInRun = *run;
+			else if (size_t const* nestedBlock = util::valueOrNullptr(info.nestedBlocks, i))
+				if (emptySince[*nestedBlock] && *emptySince[*nestedBlock] + 1 <= finalRun)
+					removedInRun = *emptySince[*nestedBlock] + 1;
+			if (removedInRun)
+			{
+				toRemove[i] = true;
+				lastRemoval = max(lastRemoval, *removedInRun);
 			}
 		}
+		if (std::all_of(toRemove.begin(), toRemove.end(), [](bool _remove) { return _remove; }))
+			emptySince[blockIndex] = lastRemoval;
 
-	removeEmptyBlocks(_block);
+		vector<Statement> remaining;
+		remaining.reserve(statements.size());
+		for (size_t i = 0; i < statements.size(); ++i)
+			if (!toRemove[i])
+				remaining.emplace_back(std::move(statements[i]));
+		statements = std::move(remaining);
+	}
+}
 
-	ASTModifier::operator()(_block);
+void UnusedPruner::run(OptimiserStepContext& _context, Block& _ast)
+{
+	auto const& analysis = _context.callGraphAnalysis.analyze(_context.dialect, _ast);
+	runUntilStabilised(
+		_context.dialect,
+		_ast,
+		!analysis.containsMSize,
+		&analysis.functionSideEffects,
+		_context.reservedIdentifiers
+	);
+	_context.callGraphAnalysis.invalidate();
 }
 
 void UnusedPruner::runUntilStabilised(
@@ -133,15 +244,9 @@ void UnusedPruner::runUntilStabilised(
 	set<YulString> const& _externallyUsedFunctions
 )
 {
-	while (true)
-	{
-		UnusedPruner pruner(
-			_dialect, _ast, _allowMSizeOptimization, _functionSideEffects,
-							_externallyUsedFunctions);
-		pruner(_ast);
-		if (!pruner.shouldRunAgain())
-			return;
-	}
+	UnusedPruner pruner(_dialect, _ast, _allowMSizeOptimization, _functionSideEffects, _externallyUsedFunctions);
+	pruner(_ast);
+	pruner.prune();
 }
 
 void UnusedPruner::runUntilStabilisedOnFullAST(
@@ -163,13 +268,9 @@ void UnusedPruner::runUntilStabilised(
 	set<YulString> const& _externallyUsedFunctions
 )
 {
-	while (true)
-	{
-		UnusedPruner pruner(_dialect, _function, _allowMSizeOptimization, _externallyUsedFunctions);
-		pruner(_function);
-		if (!pruner.shouldRunAgain())
-			return;
-	}
+	UnusedPruner pruner(_dialect, _function, _allowMSizeOptimization, _externallyUsedFunctions);
+	pruner(_function);
+	pruner.prune();
 }
 
 bool UnusedPruner::used(YulString _name) const
@@ -177,13 +278,25 @@ bool UnusedPruner::used(YulString _name) const
 	return m_references.count(_name) && m_references.at(_name) > 0;
 }
 
-void UnusedPruner::subtractReferences(map<YulString, size_t> const& _subtrahend)
+void UnusedPruner::subtractReferences(
+	map<YulString, size_t> const& _subtrahend,
+	size_t _run,
+	StatementPosition const& _position
+)
 {
 	for (auto const& ref: _subtrahend)
 	{
 		assertThrow(m_references.count(ref.first), OptimizerException, "");
 		assertThrow(m_references.at(ref.first) >= ref.second, OptimizerException, "");
 		m_references[ref.first] -= ref.second;
-		m_shouldRunAgain = true;
+		m_lastRunWithRemovals = _run;
+		if (m_references[ref.first] == 0)
+			if (auto const* definitions = util::valueOrNullptr(m_definitions, ref.first))
+				for (StatementPosition const& definition: *definitions)
+					m_worklist.emplace(
+						definition > _position ? _run : _run + 1,
+						definition.first,
+						definition.second
+					);
 	}
 }
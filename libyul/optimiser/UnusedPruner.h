@@ -27,6 +27,9 @@
 
 #include <map>
 #include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -44,23 +47,25 @@ struct SideEffects;
  *
  * Note that this does not remove circular references.
  *
+ * Instead of re-running on the whole AST until nothing changes, the pruner
+ * keeps the reference counts up to date while removing code and re-visits
+ * only the definitions whose reference count dropped to zero. The order in
+ * which statements are re-visited simulates the repeated runs, so that the
+ * result (including which emptied blocks remain) is the same.
+ *
  * Prerequisite: Disambiguator
  */
 class UnusedPruner: public ASTModifier
 {
 public:
 	static constexpr char const* name{"UnusedPruner"};
-	static void run(OptimiserStepContext& _context, Block& _ast) {
-		UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
-	}
+	static void run(OptimiserStepContext& _context, Block& _ast);
 
 
 	using ASTModifier::operator();
+	/// Registers the statements of the block and of all nested blocks for pruning.
 	void operator()(Block& _block) override;
 
-	// @returns true iff the code changed in the previous run.
-	bool shouldRunAgain() const { return m_shouldRunAgain; }
-
 	// Run the pruner until the code does not change anymore.
 	static void runUntilStabilised(
 		Dialect const& _dialect,
@@ -116,14 +121,53 @@ private:
 		std::set<YulString> const& _externallyUsedFunctions = {}
 	);
 
+	/// Index of the block in the order in which the blocks are visited
+	/// and index of the statement inside that block.
+	using StatementPosition = std::pair<size_t, size_t>;
+
+	/// Removes unused code from all registered statements until nothing changes anymore.
+	void prune();
+	/// Removes the statement at @a _position if it is unused, as part of run number @a _run.
+	void visitStatement(size_t _run, StatementPosition const& _position);
+	/// Removes the statements that were replaced by empty blocks and the nested blocks
+	/// that became empty early enough to be removed by one of the runs.
+	void removeEmptyBlocks();
+
 	bool used(YulString _name) const;
-	void subtractReferences(std::map<YulString, size_t> const& _subtrahend);
+	/// Subtracts the references of code removed at @a _position in run @a _run
+	/// and schedules the definitions that became unused.
+	void subtractReferences(
+		std::map<YulString, size_t> const& _subtrahend,
+		size_t _run,
+		StatementPosition const& _position
+	);
+
+	struct BlockInfo
+	{
+		Block* block = nullptr;
+		/// True if the block is part of the body of a removed function.
+		bool removed = false;
+		/// Indices of the blocks of statements that are blocks themselves.
+		std::map<size_t, size_t> nestedBlocks;
+	};
 
 	Dialect const& m_dialect;
 	bool m_allowMSizeOptimization = false;
 	std::map<YulString, SideEffects> const* m_functionSideEffects = nullptr;
-	bool m_shouldRunAgain = false;
 	std::map<YulString, size_t> m_references;
+
+	/// All blocks in the order in which they are visited.
+	std::vector<BlockInfo> m_blocks;
+	/// Positions of the statements that declare a given name.
+	std::map<YulString, std::vector<StatementPosition>> m_definitions;
+	/// Range of block indices that make up the body of a function definition.
+	std::map<StatementPosition, std::pair<size_t, size_t>> m_functionBodies;
+	/// Statements that were replaced by empty blocks and the run in which this happened.
+	std::map<StatementPosition, size_t> m_removedInRun;
+	/// Statements still to be visited as (run, block index, statement index).
+	std::set<std::tuple<size_t, size_t, size_t>> m_worklist;
+	/// The last run that removed references. The following run is the final one.
+	size_t m_lastRunWithRemovals = 0;
 };
 
 }
@@ -377,6 +377,13 @@ void CommandLineInterface::handleGasEstimation(string const& _contract)
 	}
 }
 
+void CommandLineInterface::handleAnalysisTimings()
+{
+	serr() << "Analysis pass timings:" << endl;
+	for (auto const& timing: m_compiler->analysisTimings())
+		serr() << "   " << timing.pass << ":\t" << timing.duration.count() << " us" << endl;
+}
+
 bool CommandLineInterface::readInputFiles()
 {
 	solAssert(!m_standardJsonInput.has_value(), "");
@@ -481,8 +488,8 @@ map<string, Json::Value> CommandLineInterface::parseAstFromInput()
 			astAssert(ast["sources"][src].isMember(astKey), "astkey is not member");
 			astAssert(ast["sources"][src][astKey]["nodeType"].asString() == "SourceUnit",  "Top-level node should be a 'SourceUnit'");
 			astAssert(sourceJsons.count(src) == 0, "All sources must have unique names");
-			sourceJsons.emplace(src, move(ast["sources"][src][astKey]));
-			tmpSources[src] = util::jsonCompactPrint(ast);
+			auto const& sourceJson = sourceJsons.emplace(src, move(ast["sources"][src][astKey])).first->second;
+			tmpSources[src] = util::jsonCompactPrint(sourceJson);
 		}
 	}
 
@@ -636,6 +643,9 @@ bool CommandLineInterface::compile()
 			formatter.printErrorInformation(*error);
 		}
 
+		if (m_options.compiler.analysisTimings)
+			handleAnalysisTimings();
+
 		if (!successful)
 			return m_options.input.errorRecovery;
 	}
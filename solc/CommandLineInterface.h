@@ -96,6 +96,7 @@ private:
 	void handleABI(std::string const& _contract);
 	void handleNatspec(bool _natspecDev, std::string const& _contract);
 	void handleGasEstimation(std::string const& _contract);
+	void handleAnalysisTimings();
 	void handleStorageLayout(std::string const& _contract);
 
 	/// Tries to read @ m_sourceCodes as a JSONs holding ASTs
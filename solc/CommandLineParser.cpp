@@ -51,6 +51,7 @@ ostream& CommandLineParser::serr()
 
 static string const g_strAbi = "abi";
 static string const g_strAllowPaths = "allow-paths";
+static string const g_strAnalysisTimings = "analysis-timings";
 static string const g_strBasePath = "base-path";
 static string const g_strAsm = "asm";
 static string const g_strAsmJson = "asm-json";
@@ -287,6 +288,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		formatting.withErrorIds == _other.formatting.withErrorIds &&
 		compiler.outputs == _other.compiler.outputs &&
 		compiler.estimateGas == _other.compiler.estimateGas &&
+		compiler.analysisTimings == _other.compiler.analysisTimings &&
 		compiler.combinedJsonRequests == _other.compiler.combinedJsonRequests &&
 		metadata.hash == _other.metadata.hash &&
 		metadata.literalSources == _other.metadata.literalSources &&
@@ -658,6 +660,10 @@ General Information)").c_str(),
 			g_strGas.c_str(),
 			"Print an estimate of the maximal gas usage for each function."
 		)
+		(
+			g_strAnalysisTimings.c_str(),
+			"Print the time spent in each analysis pass to standard error."
+		)
 		(
 			g_strCombinedJson.c_str(),
 			po::value<string>()->value_name(boost::join(g_combinedJsonArgs, ",")),
@@ -860,6 +866,7 @@ General Information)").c_str(),
 	m_options.compiler.outputs.storageLayout = (m_args.count(g_strStorageLayout) > 0);
 
 	m_options.compiler.estimateGas = (m_args.count(g_strGas) > 0);
+	m_options.compiler.analysisTimings = (m_args.count(g_strAnalysisTimings) > 0);
 
 	po::notify(m_args);
 
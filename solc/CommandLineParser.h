@@ -147,6 +147,7 @@ struct CommandLineOptions
 	{
 		CompilerOutputs outputs;
 		bool estimateGas = false;
+		bool analysisTimings = false;
 		std::optional<CombinedJsonRequests> combinedJsonRequests;
 	} compiler;
 
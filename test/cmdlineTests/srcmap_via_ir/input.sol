@@ -0,0 +1,9 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.0;
+
+contract C {
+    uint x;
+    function f(uint a) public {
+        x = a + 1;
+    }
+}
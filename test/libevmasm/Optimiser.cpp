@@ -29,6 +29,7 @@
 #include <libevmasm/JumpdestRemover.h>
 #include <libevmasm/ControlFlowGraph.h>
 #include <libevmasm/BlockDeduplicator.h>
+#include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/Assembly.h>
 
 #include <boost/test/unit_test.hpp>
@@ -1310,6 +1311,41 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(constant_optimiser_repeated_constants)
+{
+	// The representation chosen for the constant in the first assembly is reused for the second one,
+	// which still needs its own copy of the data.
+	u256 constant("0x1f2e3d4c5b6a79881f2e3d4c5b6a79881f2e3d4c5b6a79881f2e3d4c5b6a7988");
+	ConstantOptimisationCache cache;
+	auto optimise = [&](ConstantOptimisationCache* _cache)
+	{
+		Assembly assembly;
+		for (size_t i = 0; i < 20; ++i)
+		{
+			assembly.append(constant);
+			assembly.append(Instruction::POP);
+		}
+		ConstantOptimisationMethod::optimiseConstants(
+			true,
+			1,
+			solidity::test::CommonOptions::get().evmVersion(),
+			assembly,
+			_cache
+		);
+		for (AssemblyItem const& item: assembly.items())
+			if (item.type() == PushData)
+				BOOST_CHECK(!assembly.data(util::h256(item.data())).empty());
+		return assembly.items();
+	};
+
+	AssemblyItems first = optimise(&cache);
+	AssemblyItems second = optimise(&cache);
+	AssemblyItems uncached = optimise(nullptr);
+	BOOST_CHECK(ranges::any_of(first, [](AssemblyItem const& _item) { return _item.type() == PushData; }));
+	BOOST_CHECK_EQUAL_COLLECTIONS(first.begin(), first.end(), second.begin(), second.end());
+	BOOST_CHECK_EQUAL_COLLECTIONS(first.begin(), first.end(), uncached.begin(), uncached.end());
+}
+
 BOOST_AUTO_TEST_CASE(cse_sub_zero)
 {
 	checkCSE({
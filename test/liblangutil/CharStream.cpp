@@ -48,6 +48,29 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(position_to_line_column)
+{
+	CharStream const source("ab\ncd\n\nefg", "source");
+
+	auto check = [&](int _position, int _line, int _column) {
+		auto [line, column] = source.translatePositionToLineColumn(_position);
+		BOOST_CHECK_EQUAL(line, _line);
+		BOOST_CHECK_EQUAL(column, _column);
+	};
+
+	check(0, 0, 0);
+	check(1, 0, 1);
+	check(2, 0, 2);
+	check(3, 1, 0);
+	check(5, 1, 2);
+	check(6, 2, 0);
+	check(7, 3, 0);
+	check(9, 3, 2);
+	// Positions past the end are clamped.
+	check(10, 3, 3);
+	check(100, 3, 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -0,0 +1,131 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the deduplication of errors in the ErrorReporter class.
+ */
+
+#include <liblangutil/ErrorReporter.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+using namespace std;
+
+namespace solidity::langutil::test
+{
+
+namespace
+{
+
+SourceLocation location(int _start)
+{
+	static auto const sourceName = make_shared<string const>("source");
+	return SourceLocation{_start, _start + 1, sourceName};
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ErrorReporterTest)
+
+BOOST_AUTO_TEST_CASE(duplicates_are_dropped)
+{
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+	reporter.setDeduplication(true);
+
+	reporter.typeError(1234_error, location(0), "message");
+	reporter.typeError(1234_error, location(0), "message");
+	reporter.typeError(1234_error, location(1), "message");
+	reporter.typeError(1234_error, location(0), "other message");
+	BOOST_CHECK_EQUAL(errors.size(), 3);
+	BOOST_CHECK_EQUAL(reporter.errorCount(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(duplicates_are_kept_without_deduplication)
+{
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+
+	reporter.typeError(1234_error, location(0), "message");
+	reporter.typeError(1234_error, location(0), "message");
+	BOOST_CHECK_EQUAL(errors.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(copies_keep_deduplicating)
+{
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+	reporter.setDeduplication(true);
+	reporter.warning(1234_error, location(0), "message");
+
+	ErrorReporter copy(reporter);
+	copy.warning(1234_error, location(0), "message");
+	copy.warning(1234_error, location(1), "message");
+	BOOST_CHECK_EQUAL(errors.size(), 2);
+
+	ErrorList otherErrors;
+	ErrorReporter assigned(otherErrors);
+	assigned = reporter;
+	assigned.warning(1234_error, location(0), "message");
+	assigned.warning(1234_error, location(2), "message");
+	BOOST_CHECK_EQUAL(otherErrors.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(appended_errors_are_deduplicated)
+{
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+	reporter.setDeduplication(true);
+	reporter.warning(1234_error, location(0), "message");
+
+	ErrorList innerErrors;
+	ErrorReporter innerReporter(innerErrors);
+	innerReporter.warning(1234_error, location(0), "message");
+	innerReporter.warning(1234_error, location(1), "message");
+	innerReporter.warning(1234_error, location(1), "message");
+
+	reporter.append(innerReporter.errors());
+	BOOST_CHECK_EQUAL(errors.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(warnings_beyond_the_limit_are_dropped)
+{
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+	reporter.setDeduplication(true);
+
+	for (int i = 0; i < 300; ++i)
+		reporter.warning(1234_error, location(i), "message");
+	// 255 warnings and the note about the limit.
+	BOOST_CHECK_EQUAL(errors.size(), 256);
+
+	// A copy starts with fresh limits, but knows the warnings reported so far.
+	// Warnings dropped because of the limit were not recorded.
+	ErrorReporter copy(reporter);
+	copy.warning(1234_error, location(0), "message");
+	BOOST_CHECK_EQUAL(errors.size(), 256);
+	copy.warning(1234_error, location(299), "message");
+	BOOST_CHECK_EQUAL(errors.size(), 257);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -279,6 +279,32 @@ BOOST_AUTO_TEST_CASE(helper_string_result)
 	BOOST_REQUIRE_EQUAL(r1.message(), "Failure");
 }
 
+BOOST_AUTO_TEST_CASE(shared_member_lists)
+{
+	TypeProvider::reset();
+	ArrayType const* storageArray = TypeProvider::array(DataLocation::Storage, TypeProvider::uint256());
+	// Storage references are copied for every request, but have the same identifier.
+	Type const* firstReference = TypeProvider::withLocation(storageArray, DataLocation::Storage, false);
+	Type const* secondReference = TypeProvider::withLocation(storageArray, DataLocation::Storage, false);
+	BOOST_REQUIRE(firstReference != secondReference);
+
+	MemberList const& firstMembers = firstReference->members(nullptr);
+	BOOST_CHECK_EQUAL(TypeProvider::memberListCacheStatistics().misses, 1);
+	BOOST_CHECK_EQUAL(TypeProvider::memberListCacheStatistics().hits, 0);
+
+	BOOST_CHECK_EQUAL(&secondReference->members(nullptr), &firstMembers);
+	BOOST_CHECK_EQUAL(TypeProvider::memberListCacheStatistics().hits, 1);
+
+	// Member lists depend on the data location.
+	Type const* memoryArray = TypeProvider::withLocation(storageArray, DataLocation::Memory, true);
+	BOOST_CHECK(&memoryArray->members(nullptr) != &firstMembers);
+	BOOST_CHECK(memoryArray->memberType("pop") == nullptr);
+	BOOST_CHECK(firstReference->memberType("pop") != nullptr);
+
+	TypeProvider::reset();
+	BOOST_CHECK_EQUAL(TypeProvider::memberListCacheStatistics().misses, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,105 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+/// Unit tests for libsolidity/analysis/AnalysisPassManager.h
+
+#include <libsolidity/analysis/AnalysisPassManager.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+vector<string> executedPasses(AnalysisPassManager const& _manager)
+{
+	vector<string> names;
+	for (auto const& timing: _manager.timings())
+		names.push_back(timing.pass);
+	return names;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(AnalysisPassManagerTest)
+
+BOOST_AUTO_TEST_CASE(runs_passes_in_registration_order)
+{
+	AnalysisPassManager manager;
+	vector<string> log;
+	manager.addPass("a", {}, [&]() { log.emplace_back("a"); return true; });
+	manager.addPass("b", {"a"}, [&]() { log.emplace_back("b"); return true; });
+	manager.addPass("c", {}, [&]() { log.emplace_back("c"); return true; });
+
+	BOOST_CHECK(manager.run());
+	BOOST_CHECK((log == vector<string>{"a", "b", "c"}));
+	BOOST_CHECK((executedPasses(manager) == vector<string>{"a", "b", "c"}));
+	BOOST_CHECK(manager.hasRun("b"));
+}
+
+BOOST_AUTO_TEST_CASE(skipped_pass_skips_dependents)
+{
+	AnalysisPassManager manager;
+	bool enabled = false;
+	manager.addPass("a", {}, [&]() { return true; });
+	manager.addPass("b", {"a"}, [&]() { return true; }, [&]() { return enabled; });
+	manager.addPass("c", {"b"}, [&]() { return true; });
+	manager.addPass("d", {"a"}, [&]() { return true; });
+
+	BOOST_CHECK(manager.run());
+	BOOST_CHECK((executedPasses(manager) == vector<string>{"a", "d"}));
+	BOOST_CHECK(!manager.hasRun("b"));
+	BOOST_CHECK(!manager.hasRun("c"));
+
+	enabled = true;
+	BOOST_CHECK(manager.run());
+	BOOST_CHECK((executedPasses(manager) == vector<string>{"a", "b", "c", "d"}));
+}
+
+BOOST_AUTO_TEST_CASE(condition_is_evaluated_when_pass_is_reached)
+{
+	AnalysisPassManager manager;
+	bool noErrors = true;
+	manager.addPass("a", {}, [&]() { noErrors = false; return true; });
+	manager.addPass("b", {}, [&]() { return true; }, [&]() { return noErrors; });
+
+	BOOST_CHECK(manager.run());
+	BOOST_CHECK((executedPasses(manager) == vector<string>{"a"}));
+}
+
+BOOST_AUTO_TEST_CASE(abort_stops_analysis)
+{
+	AnalysisPassManager manager;
+	manager.addPass("a", {}, [&]() { return false; });
+	manager.addPass("b", {}, [&]() { return true; });
+
+	BOOST_CHECK(!manager.run());
+	BOOST_CHECK((executedPasses(manager) == vector<string>{"a"}));
+	BOOST_CHECK(!manager.hasRun("b"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -21,7 +21,6 @@ contract C {
 // TypeError 9318: (127-139): Unknown call option "val". Valid options are "salt", "value" and "gas".
 // TypeError 9886: (143-172): Duplicate option "salt".
 // TypeError 7006: (176-199): Cannot set option "value", since the constructor of contract D is not payable.
-// TypeError 7006: (176-199): Cannot set option "value", since the constructor of contract D is not payable.
 // TypeError 9318: (203-220): Unknown call option "random". Valid options are "salt", "value" and "gas".
 // TypeError 9318: (224-242): Unknown call option "what". Valid options are "salt", "value" and "gas".
 // TypeError 9903: (246-259): Function call option "gas" cannot be used with "new".
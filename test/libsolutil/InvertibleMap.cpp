@@ -0,0 +1,125 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for InvertibleMap and InvertibleRelation.
+ */
+
+#include <libsolutil/InvertibleMap.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <set>
+#include <string>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+namespace
+{
+
+template<typename K, typename V>
+bool isConsistent(InvertibleMap<K, V> const& _map)
+{
+	size_t referenceCount = 0;
+	for (auto const& [value, keys]: _map.references)
+	{
+		if (keys.empty())
+			return false;
+		for (K const& key: keys)
+		{
+			auto it = _map.values.find(key);
+			if (it == _map.values.end() || it->second != value)
+				return false;
+			++referenceCount;
+		}
+	}
+	return referenceCount == _map.values.size();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(InvertibleMapTest)
+
+BOOST_AUTO_TEST_CASE(set_and_erase)
+{
+	InvertibleMap<string, string> map;
+	map.set("a", "x");
+	map.set("b", "x");
+	map.set("c", "y");
+	BOOST_CHECK(isConsistent(map));
+	BOOST_CHECK((map.references.at("x") == set<string>{"a", "b"}));
+
+	// Overwriting a key moves it to the new value.
+	map.set("b", "y");
+	BOOST_CHECK(isConsistent(map));
+	BOOST_CHECK((map.references.at("x") == set<string>{"a"}));
+	BOOST_CHECK((map.references.at("y") == set<string>{"b", "c"}));
+
+	map.eraseKey("a");
+	BOOST_CHECK(isConsistent(map));
+	BOOST_CHECK(!map.references.count("x"));
+
+	map.eraseValue("y");
+	BOOST_CHECK(isConsistent(map));
+	BOOST_CHECK(map.empty());
+
+	// Erasing unknown entries is fine.
+	map.eraseKey("z");
+	map.eraseValue("z");
+	BOOST_CHECK(map.empty());
+}
+
+BOOST_AUTO_TEST_CASE(erase_if)
+{
+	InvertibleMap<int, int> map;
+	for (int i = 0; i < 10; ++i)
+		map.set(i, i % 3);
+	map.eraseIf([](int _key, int _value) { return _key > 5 || _value == 0; });
+	BOOST_CHECK(isConsistent(map));
+	BOOST_CHECK((std::map<int, int>(map.values.begin(), map.values.end()) == std::map<int, int>{{1, 1}, {2, 2}, {4, 1}, {5, 2}}));
+}
+
+BOOST_AUTO_TEST_CASE(relation)
+{
+	InvertibleRelation<string> relation;
+	relation.set("a", {"x", "y"});
+	relation.set("b", {"y"});
+	BOOST_CHECK((relation.backward.at("y") == set<string>{"a", "b"}));
+	BOOST_CHECK((relation.backward.at("x") == set<string>{"a"}));
+
+	relation.set("a", {"z"});
+	BOOST_CHECK(!relation.backward.count("x"));
+	BOOST_CHECK((relation.backward.at("y") == set<string>{"b"}));
+	BOOST_CHECK((relation.backward.at("z") == set<string>{"a"}));
+
+	relation.eraseKey("b");
+	BOOST_CHECK(!relation.forward.count("b"));
+	BOOST_CHECK(!relation.backward.count("y"));
+
+	relation.set("c", {});
+	BOOST_CHECK(relation.forward.count("c"));
+	relation.eraseKey("c");
+	BOOST_CHECK(!relation.forward.count("c"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
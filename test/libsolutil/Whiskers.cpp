@@ -208,6 +208,28 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unterminated_tags_rendered)
+{
+	string templ = "<#b> <?c> <!c> </b <a";
+	BOOST_CHECK_EQUAL(Whiskers(templ).render(), templ);
+}
+
+BOOST_AUTO_TEST_CASE(else_after_closing_tag)
+{
+	string templ = "<?c>A</c><!c>B";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", false).render(), "<!c>B");
+}
+
+BOOST_AUTO_TEST_CASE(same_template_different_values)
+{
+	string templ = "<?c><a><!c>-</c><#b>(<x>)</b>";
+	vector<map<string, string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("c", true)("b", list).render(), "A(1)(2)");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("c", false)("b", vector<map<string, string>>{}).render(), "-");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,78 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the cache of call graph based analyses.
+ */
+
+#include <test/Common.h>
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/CallGraphAnalysisCache.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/AST.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulCallGraphAnalysisCache)
+
+BOOST_AUTO_TEST_CASE(reuse_until_invalidated)
+{
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+	shared_ptr<Block> ast = parse(R"({
+		function f() -> x { x := msize() }
+		function g() { sstore(0, f()) }
+		g()
+	})", false).first;
+	BOOST_REQUIRE(ast);
+
+	CallGraphAnalysisCache cache;
+	auto const& analysis = cache.analyze(dialect, *ast);
+	BOOST_CHECK(analysis.containsMSize);
+	BOOST_CHECK(analysis.recursiveFunctions.empty());
+	BOOST_CHECK(!analysis.functionSideEffects.at("g"_yulstring).movable);
+	BOOST_CHECK_EQUAL(cache.statistics().recomputed, 1);
+
+	BOOST_CHECK(cache.analyze(dialect, *ast).containsMSize);
+	BOOST_CHECK_EQUAL(cache.statistics().reused, 1);
+	BOOST_CHECK_EQUAL(cache.statistics().recomputed, 1);
+
+	// Replace the body of f by a recursive call.
+	shared_ptr<Block> modified = parse(R"({
+		function f() -> x { x := f() }
+		function g() { sstore(0, f()) }
+		g()
+	})", false).first;
+	BOOST_REQUIRE(modified);
+	*ast = std::move(*modified);
+	cache.invalidate();
+	auto const& newAnalysis = cache.analyze(dialect, *ast);
+	BOOST_CHECK(!newAnalysis.containsMSize);
+	BOOST_CHECK(newAnalysis.recursiveFunctions.count("f"_yulstring));
+	BOOST_CHECK_EQUAL(cache.statistics().reused, 1);
+	BOOST_CHECK_EQUAL(cache.statistics().recomputed, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
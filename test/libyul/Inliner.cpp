@@ -20,6 +20,7 @@
  * Unit tests for the Yul function inliner.
  */
 
+#include <test/Common.h>
 #include <test/libyul/Common.h>
 
 #include <libyul/optimiser/ExpressionInliner.h>
@@ -27,6 +28,10 @@
 #include <libyul/optimiser/FullInliner.h>
 #include <libyul/optimiser/FunctionHoister.h>
 #include <libyul/optimiser/FunctionGrouper.h>
+#include <libyul/optimiser/ExpressionSplitter.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/AsmPrinter.h>
 #include <libyul/AST.h>
 
@@ -56,6 +61,19 @@ string inlinableFunctions(string const& _source)
 	return boost::algorithm::join(functionNames, ",");
 }
 
+FullInliner::Statistics fullInlinerStatistics(string const& _source, optional<size_t> _expectedExecutionsPerDeployment)
+{
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+	Block ast = disambiguate(_source, false);
+	NameDispenser dispenser{dialect, ast};
+	set<YulString> reservedIdentifiers;
+	OptimiserStepContext context{dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
+	FunctionHoister::run(context, ast);
+	FunctionGrouper::run(context, ast);
+	ExpressionSplitter::run(context, ast);
+	return FullInliner::runWithStatistics(context, ast);
+}
+
 }
 
 
@@ -109,4 +127,36 @@ BOOST_AUTO_TEST_CASE(negative)
 }
 
 
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(YulFullInliner)
+
+BOOST_AUTO_TEST_CASE(code_growth_budget)
+{
+	string source = R"({
+		function f(a) -> b { b := mload(add(a, mload(add(a, 2)))) }
+		function g1(a) { sstore(f(a), f(a)) }
+		function g2(a) { sstore(f(a), f(a)) }
+		function g3(a) { sstore(f(a), f(a)) }
+		function g4(a) { sstore(f(a), f(a)) }
+	})";
+
+	auto creation = fullInlinerStatistics(source, nullopt);
+	auto standard = fullInlinerStatistics(source, 200);
+	auto frequent = fullInlinerStatistics(source, 100000);
+
+	BOOST_CHECK_EQUAL(standard.initialCodeSize, creation.initialCodeSize);
+	BOOST_CHECK_EQUAL(creation.codeGrowthBudget, creation.initialCodeSize);
+	BOOST_CHECK_EQUAL(standard.codeGrowthBudget, 2 * standard.initialCodeSize);
+	BOOST_CHECK_EQUAL(frequent.codeGrowthBudget, 16 * frequent.initialCodeSize);
+
+	for (auto const& statistics: {creation, standard, frequent})
+	{
+		BOOST_CHECK_LE(statistics.estimatedCodeGrowth, statistics.codeGrowthBudget);
+		BOOST_CHECK_GT(statistics.finalCodeSize, statistics.initialCodeSize);
+	}
+	BOOST_CHECK_LT(creation.finalCodeSize, standard.finalCodeSize);
+	BOOST_CHECK_LT(standard.finalCodeSize, frequent.finalCodeSize);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,85 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the cached base + offset forms in the KnowledgeBase.
+ */
+
+#include <test/Common.h>
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/KnowledgeBase.h>
+#include <libyul/optimiser/DataFlowAnalyzer.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/AST.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulKnowledgeBase)
+
+BOOST_AUTO_TEST_CASE(offset_cache_statistics)
+{
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+	shared_ptr<Block> ast = parse(R"({
+		let a := calldataload(0)
+		let b := add(a, 32)
+		let c := add(b, 1)
+		let d := calldataload(32)
+	})", false).first;
+	BOOST_REQUIRE(ast);
+
+	map<YulString, AssignedValue> values;
+	for (auto const& statement: ast->statements)
+	{
+		auto const& declaration = get<VariableDeclaration>(statement);
+		values[declaration.variables.front().name] = AssignedValue{declaration.value.get(), 0};
+	}
+
+	KnowledgeBase knowledge(dialect, values);
+	auto const& statistics = knowledge.statistics();
+
+	// c is b + 1, which is a + 33.
+	BOOST_CHECK(knowledge.knownToBeDifferent("b"_yulstring, "c"_yulstring));
+	BOOST_CHECK(!knowledge.knownToBeDifferentByAtLeast32("b"_yulstring, "c"_yulstring));
+	BOOST_CHECK(knowledge.knownToBeDifferentByAtLeast32("a"_yulstring, "c"_yulstring));
+	size_t const misses = statistics.offsetCacheMisses;
+	BOOST_CHECK_EQUAL(misses, 3);
+	BOOST_CHECK(statistics.offsetCacheHits > 0);
+	BOOST_CHECK_EQUAL(statistics.simplifications, 0);
+
+	// The forms of a and d have different bases, so the rules are used.
+	size_t const hits = statistics.offsetCacheHits;
+	BOOST_CHECK(!knowledge.knownToBeDifferent("a"_yulstring, "d"_yulstring));
+	BOOST_CHECK_EQUAL(statistics.offsetCacheMisses, misses + 1);
+	BOOST_CHECK_EQUAL(statistics.offsetCacheHits, hits + 1);
+	BOOST_CHECK_EQUAL(statistics.simplifications, 1);
+
+	// A change to a value the cached forms depend on drops them.
+	knowledge.valueChanged("a"_yulstring);
+	BOOST_CHECK(knowledge.knownToBeDifferent("b"_yulstring, "c"_yulstring));
+	BOOST_CHECK(statistics.offsetCacheMisses > misses + 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -27,6 +27,8 @@
 #include <libyul/optimiser/ReasoningBasedSimplifier.h>
 #include <libyul/AsmPrinter.h>
 
+#include <libsolidity/interface/OptimiserSettings.h>
+
 #include <liblangutil/SourceReferenceFormatter.h>
 #include <liblangutil/Scanner.h>
 
@@ -60,6 +62,13 @@ YulOptimizerTest::YulOptimizerTest(string const& _filename):
 
 	m_source = m_reader.source();
 
+	m_reasoningBasedSimplifierMaxChecks = OptimiserSettings{}.reasoningBasedSimplifierMaxChecks;
+	if (m_optimizerStep == "reasoningBasedSimplifier")
+		m_reasoningBasedSimplifierMaxChecks = m_reader.sizetSetting(
+			"reasoningBasedSimplifierMaxChecks",
+			m_reasoningBasedSimplifierMaxChecks
+		);
+
 	auto dialectName = m_reader.stringSetting("dialect", "evm");
 	m_dialect = &dialect(dialectName, solidity::test::CommonOptions::get().evmVersion());
 
@@ -77,6 +86,7 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 	m_object->analysisInfo = m_analysisInfo;
 	YulOptimizerTestCommon tester(m_object, *m_dialect);
 	tester.setStep(m_optimizerStep);
+	tester.setReasoningBasedSimplifierMaxChecks(m_reasoningBasedSimplifierMaxChecks);
 
 	if (!tester.runStep())
 	{
@@ -53,6 +53,7 @@ private:
 	);
 
 	std::string m_optimizerStep;
+	size_t m_reasoningBasedSimplifierMaxChecks = 0;
 
 	Dialect const* m_dialect = nullptr;
 
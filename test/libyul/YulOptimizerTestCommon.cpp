@@ -446,6 +446,7 @@ void YulOptimizerTestCommon::updateContext()
 		*m_dialect,
 		*m_nameDispenser,
 		m_reservedIdentifiers,
-		frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment
+		frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment,
+		m_reasoningBasedSimplifierMaxChecks
 	});
 }
@@ -45,6 +45,8 @@ public:
 	/// Sets optimiser step to be run to @param
 	/// _optimiserStep.
 	void setStep(std::string const& _optimizerStep);
+	/// Sets the maximum number of solver queries per function of the ReasoningBasedSimplifier.
+	void setReasoningBasedSimplifierMaxChecks(size_t _maxChecks) { m_reasoningBasedSimplifierMaxChecks = _maxChecks; }
 	/// Runs chosen optimiser step returning pointer
 	/// to yul AST Block post optimisation.
 	std::shared_ptr<Block> run();
@@ -66,6 +68,7 @@ private:
 	std::set<YulString> m_reservedIdentifiers;
 	std::unique_ptr<NameDispenser> m_nameDispenser;
 	std::unique_ptr<OptimiserStepContext> m_context;
+	size_t m_reasoningBasedSimplifierMaxChecks = OptimiserStepContext::defaultReasoningBasedSimplifierMaxChecks;
 
 	std::shared_ptr<Object> m_object;
 	std::shared_ptr<Block> m_ast;
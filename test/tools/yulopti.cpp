@@ -29,6 +29,7 @@
 #include <libyul/AST.h>
 #include <libyul/AsmParser.h>
 #include <libyul/AsmPrinter.h>
+#include <libyul/AssemblyStack.h>
 #include <libyul/Object.h>
 #include <liblangutil/SourceReferenceFormatter.h>
 
@@ -49,6 +50,8 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/join.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
 
 #include <range/v3/action/sort.hpp>
@@ -60,12 +63,21 @@
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/transform.hpp>
 
+#include <algorithm>
 #include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <optional>
 #include <string>
 #include <sstream>
 #include <iostream>
 #include <variant>
 
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -74,6 +86,7 @@ using namespace solidity::frontend;
 using namespace solidity::yul;
 
 namespace po = boost::program_options;
+namespace fs = boost::filesystem;
 
 class YulOpti
 {
@@ -232,6 +245,25 @@ public:
 		}
 	}
 
+	/// Parses @a _source as a Yul object (or a bare block of code) and runs the full optimiser
+	/// suite with the step sequence @a _steps on it and all its sub-objects, the same way the
+	/// compiler does.
+	/// @returns false if the source could not be parsed or analyzed.
+	static bool runNonInteractive(string const& _source, string const& _steps)
+	{
+		OptimiserSettings settings = OptimiserSettings::full();
+		settings.yulOptimiserSteps = _steps;
+		AssemblyStack stack(EVMVersion{}, AssemblyStack::Language::StrictAssembly, settings);
+		if (!stack.parseAndAnalyze("", _source))
+		{
+			cerr << "Error parsing or analyzing source." << endl;
+			SourceReferenceFormatter{cerr, stack, true, false}.printErrorInformation(stack.errors());
+			return false;
+		}
+		stack.optimize();
+		return true;
+	}
+
 private:
 	ErrorList m_errors;
 	shared_ptr<Scanner> m_scanner;
@@ -241,6 +273,173 @@ private:
 	shared_ptr<NameDispenser> m_nameDispenser;
 };
 
+/// Time spent optimising a file in batch mode, nullopt if it failed.
+using BatchResult = optional<chrono::milliseconds>;
+
+/// Optimises @a _file with the step sequence @a _steps. Errors are reported on stderr.
+BatchResult optimizeFile(fs::path const& _file, string const& _steps)
+{
+	bool success = false;
+	auto start = chrono::steady_clock::now();
+	try
+	{
+		success = YulOpti::runNonInteractive(readFileAsString(_file.string()), _steps);
+	}
+	catch (boost::exception const& _exception)
+	{
+		cerr << "Exception while optimizing " << _file.filename().string() << ": " << boost::diagnostic_information(_exception) << endl;
+	}
+	catch (std::exception const& _exception)
+	{
+		cerr << "Exception while optimizing " << _file.filename().string() << ": " << _exception.what() << endl;
+	}
+	catch (...)
+	{
+		cerr << "Unknown exception while optimizing " << _file.filename().string() << "." << endl;
+	}
+	if (!success)
+		return nullopt;
+	return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+}
+
+#if !defined(_WIN32)
+/// Optimises @a _files in @a _jobs worker processes. The i-th worker takes every
+/// @a _jobs-th file starting with the i-th one and reports the result for each file as
+/// a single short line on a pipe shared by all workers. Such writes to a pipe are atomic.
+/// Processes instead of threads are used because the optimiser relies on process-wide
+/// state that is not synchronised, like the repository of YulStrings.
+/// Files of workers that could not be started or that crashed count as failed.
+vector<BatchResult> optimizeInWorkers(vector<fs::path> const& _files, string const& _steps, size_t _jobs)
+{
+	vector<BatchResult> results(_files.size());
+	int resultPipe[2];
+	if (pipe(resultPipe) != 0)
+	{
+		cerr << "Could not create a pipe for the worker processes." << endl;
+		return results;
+	}
+
+	// Buffered output would otherwise be written by every worker again.
+	cout.flush();
+	cerr.flush();
+	vector<pid_t> workers;
+	for (size_t worker = 0; worker < _jobs; ++worker)
+	{
+		pid_t pid = fork();
+		if (pid == 0)
+		{
+			close(resultPipe[0]);
+			for (size_t index = worker; index < _files.size(); index += _jobs)
+			{
+				BatchResult result = optimizeFile(_files[index], _steps);
+				string line = to_string(index) + " " + (result ? to_string(result->count()) : "-") + "\n";
+				if (write(resultPipe[1], line.data(), line.size()) != static_cast<ssize_t>(line.size()))
+					_exit(1);
+			}
+			_exit(0);
+		}
+		else if (pid < 0)
+			cerr << "Could not start worker process " << worker << "." << endl;
+		else
+			workers.push_back(pid);
+	}
+	close(resultPipe[1]);
+
+	string output;
+	char buffer[4096];
+	for (ssize_t length; (length = read(resultPipe[0], buffer, sizeof(buffer))) != 0;)
+		if (length > 0)
+			output.append(buffer, static_cast<size_t>(length));
+		else if (errno != EINTR)
+			break;
+	close(resultPipe[0]);
+	for (pid_t worker: workers)
+		waitpid(worker, nullptr, 0);
+
+	istringstream lines(output);
+	size_t index;
+	string duration;
+	while (lines >> index >> duration)
+		if (index < results.size() && duration != "-")
+			results[index] = chrono::milliseconds(stoll(duration));
+	return results;
+}
+#endif
+
+/// Optimises every .yul file in @a _directory (in lexicographical order) using @a _jobs
+/// processes and prints the time spent in the parser and the optimiser for each of them.
+/// Files that cannot be read, parsed or optimised are reported and counted as failures.
+/// @returns the exit code of the tool.
+int runBatch(string const& _directory, string const& _steps, size_t _jobs)
+{
+	try
+	{
+		OptimiserSuite::validateSequence(_steps);
+	}
+	catch (OptimizerException const& _exception)
+	{
+		cerr << "Invalid optimizer step sequence: " << _exception.what() << endl;
+		return 1;
+	}
+
+	if (!fs::is_directory(_directory))
+	{
+		cerr << "Not a directory: " << _directory << endl;
+		return 1;
+	}
+	if (_jobs == 0)
+	{
+		cerr << "The number of jobs has to be at least one." << endl;
+		return 1;
+	}
+
+	vector<fs::path> files;
+	for (fs::directory_entry const& entry: fs::directory_iterator(_directory))
+		if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".yul")
+			files.push_back(entry.path());
+	sort(files.begin(), files.end());
+
+	auto start = chrono::steady_clock::now();
+	vector<BatchResult> results;
+	if (_jobs > 1)
+	{
+#if defined(_WIN32)
+		cerr << "Parallel batch mode is not supported on this platform." << endl;
+		return 1;
+#else
+		results = optimizeInWorkers(files, _steps, min(_jobs, files.size()));
+#endif
+	}
+	else
+		for (fs::path const& file: files)
+			results.emplace_back(optimizeFile(file, _steps));
+	auto wallClockTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+
+	size_t failures = 0;
+	chrono::milliseconds total{0};
+	for (size_t i = 0; i < files.size(); ++i)
+	{
+		cout << files[i].filename().string() << ": ";
+		if (results[i])
+		{
+			total += *results[i];
+			cout << results[i]->count() << " ms" << endl;
+		}
+		else
+		{
+			++failures;
+			cout << "failed" << endl;
+		}
+	}
+	cout << "Total: " << total.count() << " ms for " << (files.size() - failures) << " file(s)";
+	if (failures > 0)
+		cout << ", " << failures << " failed";
+	cout << endl;
+	cout << "Wall-clock time: " << wallClockTime.count() << " ms using " << _jobs << " job(s)" << endl;
+
+	return failures > 0 ? 1 : 0;
+}
+
 int main(int argc, char** argv)
 {
 	po::options_description options(
@@ -249,6 +448,10 @@ Usage: yulopti [Options] <file>
 Reads <file> as yul code and applies optimizer steps to it,
 interactively read from stdin.
 
+Usage: yulopti --batch <directory> [--steps <sequence>] [--jobs <N>]
+Runs the optimizer suite on every .yul file in <directory>
+and reports the time spent on each of them.
+
 Allowed options)",
 		po::options_description::m_default_line_length,
 		po::options_description::m_default_line_length - 23);
@@ -258,6 +461,21 @@ Allowed options)",
 			po::value<string>(),
 			"input file"
 		)
+		(
+			"batch",
+			po::value<string>()->value_name("directory"),
+			"Optimize all .yul files in the given directory non-interactively and print timing information."
+		)
+		(
+			"steps",
+			po::value<string>()->default_value(OptimiserSettings::DefaultYulOptimiserSteps)->value_name("sequence"),
+			"Optimizer step sequence used in batch mode."
+		)
+		(
+			"jobs,j",
+			po::value<size_t>()->default_value(1)->value_name("N"),
+			"Number of processes optimizing files in parallel in batch mode."
+		)
 		("help", "Show this help screen.");
 
 	// All positional options should be interpreted as input files
@@ -277,6 +495,13 @@ Allowed options)",
 		return 1;
 	}
 
+	if (arguments.count("batch"))
+		return runBatch(
+			arguments["batch"].as<string>(),
+			arguments["steps"].as<string>(),
+			arguments["jobs"].as<size_t>()
+		);
+
 	string input;
 	try
 	{